@@ -38,12 +38,18 @@ class CppqlConan(ConanFile):
     
     options = {
         "zero_based_indices": [True, False],
-        "shutdown_default_off": [True, False]
+        "shutdown_default_off": [True, False],
+        "enable_memsys5": [True, False],
+        "enable_scanstatus": [True, False],
+        "enable_snapshot": [True, False]
     }
     
     default_options = {
         "zero_based_indices": True,
-        "shutdown_default_off": False
+        "shutdown_default_off": False,
+        "enable_memsys5": False,
+        "enable_scanstatus": False,
+        "enable_snapshot": False
     }
     
     ############################################################################
@@ -108,6 +114,12 @@ class CppqlConan(ConanFile):
             tc.variables["CPPQL_BIND_ZERO_BASED_INDICES"] = True
         if self.options.shutdown_default_off:
             tc.variables["CPPQL_SHUTDOWN_DEFAULT_OFF"] = True
+        if self.options.enable_memsys5:
+            tc.variables["CPPQL_ENABLE_MEMSYS5"] = True
+        if self.options.enable_scanstatus:
+            tc.variables["CPPQL_ENABLE_SCANSTATUS"] = True
+        if self.options.enable_snapshot:
+            tc.variables["CPPQL_ENABLE_SNAPSHOT"] = True
 
         tc.generate()
         
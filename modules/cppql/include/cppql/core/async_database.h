@@ -0,0 +1,314 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/database.h"
+
+namespace sql
+{
+    /**
+     * \brief How the AsyncDatabase groups submissions into shared transactions.
+     */
+    struct GroupCommitPolicy
+    {
+        /**
+         * \brief Maximum number of submissions that are committed together. With a value of 1 group commit is
+         * disabled, and each submission runs on its own without an enclosing transaction.
+         */
+        size_t maxBatchSize = 1;
+
+        /**
+         * \brief Maximum time the writer thread waits for more submissions after the first submission of a batch.
+         */
+        std::chrono::microseconds maxLatency{0};
+    };
+
+    /**
+     * \brief Counters of an AsyncDatabase.
+     */
+    struct AsyncDatabaseStats
+    {
+        /**
+         * \brief Number of completed submissions, including those that failed.
+         */
+        int64_t submissions = 0;
+
+        /**
+         * \brief Number of transactions run by group commit.
+         */
+        int64_t batches = 0;
+
+        /**
+         * \brief Number of transactions run by group commit that could not be committed.
+         */
+        int64_t failedBatches = 0;
+    };
+
+    /**
+     * \brief The AsyncDatabase class owns a Database and runs all work on it on a dedicated writer thread, so that
+     * callers do not block on locks or fsync. Work is submitted through a lock-free multi-producer single-consumer
+     * queue and executed in submission order. Each submission returns a std::future that holds the result or the
+     * exception that was thrown.
+     *
+     * With group commit enabled, the writer thread collects submissions for up to a latency budget or batch size and
+     * runs them inside of one immediate Transaction, each in its own Savepoint. A submission that throws only rolls
+     * back its own savepoint. Futures are completed after the transaction was committed, and all submissions of a
+     * batch fail if the commit fails. Submitted work must not begin or end transactions itself in this mode.
+     *
+     * Statements used with the AsyncDatabase must be compiled against its database, i.e. inside of a submitted
+     * function, and must afterwards only be invoked through submit. A statement passed to submit must stay alive
+     * until the future of every submission that uses it is ready, including submissions that are only run by the
+     * draining destructor. Because statements refer to the database, they must in turn be destroyed before the
+     * AsyncDatabase, so wait for their futures first. Arguments are copied into the queue, but the data referenced by
+     * text and blob arguments must stay alive until the future is ready.
+     */
+    class AsyncDatabase
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        AsyncDatabase() = delete;
+
+        /**
+         * \brief Take ownership of a database and start the writer thread. The database must not be used directly
+         * anymore.
+         * \param db Database.
+         * \param policy Group commit policy.
+         */
+        explicit AsyncDatabase(DatabasePtr db, const GroupCommitPolicy& policy = {});
+
+        AsyncDatabase(const AsyncDatabase&) = delete;
+
+        AsyncDatabase(AsyncDatabase&&) = delete;
+
+        /**
+         * \brief Run all work that was submitted before, then stop the writer thread and destroy the database. No
+         * work may be submitted concurrently.
+         */
+        ~AsyncDatabase() noexcept;
+
+        AsyncDatabase& operator=(const AsyncDatabase&) = delete;
+
+        AsyncDatabase& operator=(AsyncDatabase&&) = delete;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get the number of submissions that were not completed yet.
+         * \return Number of submissions.
+         */
+        [[nodiscard]] size_t getPendingCount() const noexcept;
+
+        [[nodiscard]] const GroupCommitPolicy& getPolicy() const noexcept;
+
+        [[nodiscard]] AsyncDatabaseStats getStats() const;
+
+        ////////////////////////////////////////////////////////////////
+        // Submit.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Run a function on the writer thread.
+         * \tparam F Function type.
+         * \param f Function that receives the database. Must return by value.
+         * \return Future that holds the return value of the function.
+         */
+        template<std::invocable<Database&> F>
+            requires(!std::is_reference_v<std::invoke_result_t<std::decay_t<F>&, Database&>>)
+        [[nodiscard]] std::future<std::invoke_result_t<std::decay_t<F>&, Database&>> submit(F&& f)
+        {
+            using result_t = std::invoke_result_t<std::decay_t<F>&, Database&>;
+
+            auto* task   = new TaskImpl<std::decay_t<F>, result_t>(std::forward<F>(f));
+            auto  future = task->promise.get_future();
+            push(task);
+            return future;
+        }
+
+        /**
+         * \brief Invoke a compiled statement on the writer thread.
+         * \tparam S Statement type.
+         * \tparam Args Argument types.
+         * \param statement Statement compiled against the database of this object. Must stay alive until the future
+         * is ready.
+         * \param args Arguments. Copied into the queue.
+         * \return Future that holds the return value of the statement.
+         */
+        template<typename S, typename... Args>
+            requires(!std::invocable<S&, Database&> && std::invocable<S&, std::decay_t<Args>&...>)
+        [[nodiscard]] std::future<std::invoke_result_t<S&, std::decay_t<Args>&...>> submit(S& statement, Args&&... args)
+        {
+            return submit([&statement, ... values = std::forward<Args>(args)](Database&) mutable {
+                return std::invoke(statement, values...);
+            });
+        }
+
+    private:
+        /**
+         * \brief Node of the queue.
+         */
+        struct Node
+        {
+            std::atomic<Node*> next = nullptr;
+        };
+
+        /**
+         * \brief Submitted work. Running it and completing its future are separate steps, so that group commit can
+         * delay the latter until the transaction was committed.
+         */
+        struct Task : Node
+        {
+            virtual ~Task() noexcept = default;
+
+            /**
+             * \brief Run the function and store its result or exception.
+             */
+            virtual void run(Database& db) noexcept = 0;
+
+            /**
+             * \brief Whether running the function threw an exception.
+             */
+            [[nodiscard]] virtual bool failed() const noexcept = 0;
+
+            /**
+             * \brief Complete the future with the stored result or exception.
+             */
+            virtual void complete() noexcept = 0;
+
+            /**
+             * \brief Complete the future with an exception, discarding the stored result.
+             */
+            virtual void fail(std::exception_ptr error) noexcept = 0;
+        };
+
+        template<typename F, typename R>
+        struct TaskImpl final : Task
+        {
+            template<typename G>
+            explicit TaskImpl(G&& f) : function(std::forward<G>(f))
+            {
+            }
+
+            void run(Database& db) noexcept override
+            {
+                try
+                {
+                    if constexpr (std::is_void_v<R>)
+                        std::invoke(function, db);
+                    else
+                        result.emplace(std::invoke(function, db));
+                }
+                catch (...)
+                {
+                    error = std::current_exception();
+                }
+            }
+
+            [[nodiscard]] bool failed() const noexcept override { return error != nullptr; }
+
+            void complete() noexcept override
+            {
+                if (error)
+                    promise.set_exception(error);
+                else if constexpr (std::is_void_v<R>)
+                    promise.set_value();
+                else
+                    promise.set_value(std::move(*result));
+            }
+
+            void fail(std::exception_ptr e) noexcept override { promise.set_exception(std::move(e)); }
+
+            F                                                                       function;
+            std::promise<R>                                                         promise;
+            std::optional<std::conditional_t<std::is_void_v<R>, std::monostate, R>> result;
+            std::exception_ptr                                                      error;
+        };
+
+        /**
+         * \brief Append a task to the queue and wake the writer thread. Safe to call from multiple threads.
+         */
+        void push(Task* task) noexcept;
+
+        /**
+         * \brief Append a node to the queue.
+         */
+        void enqueue(Node* node) noexcept;
+
+        /**
+         * \brief Remove the oldest task from the queue. Only called by the writer thread.
+         * \return Task, or nullptr if the queue is empty or a producer is in the middle of appending.
+         */
+        [[nodiscard]] Task* dequeue() noexcept;
+
+        void run(const std::stop_token& stop);
+
+        /**
+         * \brief Add submissions to a batch until it is full or the latency budget of the first one is spent.
+         */
+        void collect(std::vector<Task*>& batch, const std::stop_token& stop);
+
+        /**
+         * \brief Run a batch of submissions, complete their futures and delete them.
+         */
+        void execute(std::vector<Task*>& batch);
+
+        DatabasePtr database;
+
+        GroupCommitPolicy policy;
+
+        AsyncDatabaseStats stats;
+
+        mutable std::mutex statsMutex;
+
+        /**
+         * \brief Placeholder node, so that the queue is never empty.
+         */
+        Node stub;
+
+        /**
+         * \brief Most recently appended node. Written by producers.
+         */
+        std::atomic<Node*> head;
+
+        /**
+         * \brief Oldest node. Only accessed by the writer thread.
+         */
+        Node* tail;
+
+        /**
+         * \brief Incremented after every push, so that the writer thread can wait for new work.
+         */
+        std::atomic<uint32_t> signal = 0;
+
+        std::atomic<size_t> pending = 0;
+
+        std::jthread thread;
+    };
+}  // namespace sql
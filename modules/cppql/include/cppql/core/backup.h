@@ -0,0 +1,42 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+
+namespace sql
+{
+    /**
+     * \brief Settings of an online backup made with Database::backupTo.
+     */
+    struct BackupOptions
+    {
+        /**
+         * \brief Number of pages to copy per step. The source database is only locked while a step runs. A negative
+         * value copies all pages in a single step.
+         */
+        int32_t pagesPerStep = 256;
+
+        /**
+         * \brief Time to sleep between steps, and before retrying a step when the source or destination is locked.
+         * Gives writers on the source database a chance to run.
+         */
+        std::chrono::milliseconds sleep = std::chrono::milliseconds(1);
+
+        /**
+         * \brief Maximum time to keep retrying while the source or destination stays locked. The time restarts after
+         * every step that copies pages. When it runs out, the backup fails with SQLITE_BUSY or SQLITE_LOCKED.
+         */
+        std::chrono::milliseconds busyTimeout = std::chrono::seconds(5);
+
+        /**
+         * \brief Called after every step with the number of pages that remain to be copied and the total number of
+         * pages. If the source database is modified during the backup, the total can change between steps.
+         */
+        std::function<void(int32_t remaining, int32_t pageCount)> progress;
+    };
+}  // namespace sql
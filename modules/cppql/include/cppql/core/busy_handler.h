@@ -0,0 +1,173 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <random>
+
+namespace sql
+{
+    /**
+     * \brief Parameters of the exponential backoff that is used when the database is locked by another connection.
+     */
+    struct BusyPolicy
+    {
+        /**
+         * \brief Delay before the first retry.
+         */
+        std::chrono::microseconds initialDelay = std::chrono::milliseconds(1);
+
+        /**
+         * \brief Upper bound of the delay between two retries. The delay doubles after every retry until it is capped.
+         */
+        std::chrono::microseconds maxDelay = std::chrono::milliseconds(50);
+
+        /**
+         * \brief Maximum total time to wait for a lock before giving up with SQLITE_BUSY.
+         */
+        std::chrono::microseconds maxWait = std::chrono::seconds(5);
+
+        /**
+         * \brief Fraction in [0, 1] of each delay that is randomized, so that competing connections do not retry in
+         * lockstep.
+         */
+        double jitter = 0.5;
+    };
+
+    /**
+     * \brief Counters collected by a BusyHandler.
+     */
+    struct BusyStats
+    {
+        /**
+         * \brief Number of times a lock could not be acquired immediately.
+         */
+        size_t busyCount = 0;
+
+        /**
+         * \brief Number of retries, summed over all busy events.
+         */
+        size_t retryCount = 0;
+
+        /**
+         * \brief Number of busy events that exceeded the maximum wait time.
+         */
+        size_t timeoutCount = 0;
+
+        /**
+         * \brief Total time spent sleeping.
+         */
+        std::chrono::microseconds waitTime{0};
+    };
+
+    /**
+     * \brief The BusyHandler class implements a sqlite busy handler that sleeps with jittered exponential backoff
+     * according to a BusyPolicy.
+     */
+    class BusyHandler
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        BusyHandler() = delete;
+
+        explicit BusyHandler(const BusyPolicy& p);
+
+        BusyHandler(const BusyHandler&) = delete;
+
+        BusyHandler(BusyHandler&&) = delete;
+
+        ~BusyHandler() noexcept = default;
+
+        BusyHandler& operator=(const BusyHandler&) = delete;
+
+        BusyHandler& operator=(BusyHandler&&) = delete;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const BusyPolicy& getPolicy() const noexcept;
+
+        /**
+         * \brief Get counters. Can be called from any thread.
+         * \return BusyStats.
+         */
+        [[nodiscard]] BusyStats getStats() const noexcept;
+
+        /**
+         * \brief Reset all counters to 0.
+         */
+        void resetStats() noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // ...
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Calculate the delay before a retry.
+         * \param count Number of retries so far.
+         * \return Delay.
+         */
+        [[nodiscard]] std::chrono::microseconds backoff(int32_t count);
+
+        /**
+         * \brief Handle a busy event. Sleeps and returns true if the operation should be retried, returns false if the
+         * maximum wait time would be exceeded.
+         * \param count Number of times the handler was invoked for the current busy event.
+         * \return True to retry.
+         */
+        bool wait(int32_t count);
+
+        /**
+         * \brief Callback that can be passed to sqlite3_busy_handler, with a pointer to a BusyHandler as argument.
+         * \param handler BusyHandler.
+         * \param count Number of times the handler was invoked for the current busy event.
+         * \return Nonzero to retry.
+         */
+        static int32_t callback(void* handler, int32_t count) noexcept;
+
+    private:
+        friend class Transaction;
+
+        /**
+         * \brief Wait before retrying an operation that failed outside of the busy handling of sqlite, e.g. beginning
+         * a transaction whose read lock cannot be upgraded. Unlike wait, this does not start a new busy event, and the
+         * time already spent is tracked by the caller.
+         * \param count Number of retries so far.
+         * \param spent Total time the caller has spent on the operation so far.
+         * \return True to retry, false if the maximum wait time would be exceeded.
+         */
+        bool retry(int32_t count, std::chrono::microseconds spent);
+
+        /**
+         * \brief Sleep and update the counters.
+         * \param delay Delay.
+         * \return Time actually slept.
+         */
+        std::chrono::microseconds sleep(std::chrono::microseconds delay);
+
+        BusyPolicy policy;
+
+        /**
+         * \brief Time spent waiting during the current busy event.
+         */
+        std::chrono::microseconds elapsed{0};
+
+        std::minstd_rand rng;
+
+        std::atomic<size_t> busyCount = 0;
+
+        std::atomic<size_t> retryCount = 0;
+
+        std::atomic<size_t> timeoutCount = 0;
+
+        std::atomic<int64_t> waitTime = 0;
+    };
+}  // namespace sql
@@ -0,0 +1,135 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <optional>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/interrupt_error.h"
+
+namespace sql
+{
+    class Database;
+
+    /**
+     * \brief The CancellationToken class is a flag that can be set from any thread to stop the statements running
+     * inside of a CancellationScope. Copies share the same flag.
+     */
+    class CancellationToken
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        CancellationToken();
+
+        CancellationToken(const CancellationToken&) = default;
+
+        CancellationToken(CancellationToken&&) noexcept = default;
+
+        ~CancellationToken() noexcept = default;
+
+        CancellationToken& operator=(const CancellationToken&) = default;
+
+        CancellationToken& operator=(CancellationToken&&) noexcept = default;
+
+        ////////////////////////////////////////////////////////////////
+        // ...
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Request cancellation. Can be called from any thread.
+         */
+        void cancel() const noexcept;
+
+        [[nodiscard]] bool isCancelled() const noexcept;
+
+    private:
+        std::shared_ptr<std::atomic<bool>> cancelled;
+    };
+
+    /**
+     * \brief The CancellationScope class limits the statements that run on a database while it exists. A statement is
+     * interrupted with an InterruptError once the deadline has passed or the token was cancelled. Long running steps
+     * are stopped by a progress handler, and select statements additionally check before every row. Scopes can be
+     * nested and must be destroyed in reverse order of creation.
+     */
+    class CancellationScope
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        CancellationScope() = delete;
+
+        /**
+         * \brief Stop statements when a token is cancelled.
+         * \param db Database.
+         * \param token Token.
+         */
+        CancellationScope(Database& db, CancellationToken token);
+
+        /**
+         * \brief Stop statements once a deadline has passed.
+         * \param db Database.
+         * \param deadline Deadline.
+         */
+        CancellationScope(Database& db, std::chrono::steady_clock::time_point deadline);
+
+        /**
+         * \brief Stop statements once a timeout has expired.
+         * \param db Database.
+         * \param timeout Timeout, starting now.
+         */
+        CancellationScope(Database& db, std::chrono::nanoseconds timeout);
+
+        /**
+         * \brief Stop statements once a deadline has passed or a token is cancelled, whichever happens first.
+         * \param db Database.
+         * \param deadline Deadline.
+         * \param token Token.
+         */
+        CancellationScope(Database& db, std::chrono::steady_clock::time_point deadline, CancellationToken token);
+
+        CancellationScope(const CancellationScope&) = delete;
+
+        CancellationScope(CancellationScope&&) = delete;
+
+        ~CancellationScope() noexcept;
+
+        CancellationScope& operator=(const CancellationScope&) = delete;
+
+        CancellationScope& operator=(CancellationScope&&) = delete;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const std::optional<std::chrono::steady_clock::time_point>& getDeadline() const noexcept;
+
+        [[nodiscard]] const std::optional<CancellationToken>& getToken() const noexcept;
+
+        /**
+         * \brief Check whether statements in this scope must stop.
+         * \return Reason, or std::nullopt if they can continue.
+         */
+        [[nodiscard]] std::optional<InterruptReason> check() const noexcept;
+
+    private:
+        Database* database;
+
+        std::optional<std::chrono::steady_clock::time_point> deadline;
+
+        std::optional<CancellationToken> token;
+    };
+}  // namespace sql
@@ -0,0 +1,195 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <stop_token>
+#include <thread>
+
+struct sqlite3;
+
+namespace sql
+{
+    class Database;
+
+    /**
+     * \brief Checkpoint mode, as passed to sqlite3_wal_checkpoint_v2.
+     */
+    enum class CheckpointMode
+    {
+        // Checkpoint as many frames as possible without waiting for readers or writers.
+        Passive,
+        // Wait for writers, then checkpoint all frames.
+        Full,
+        // Like Full, and also wait for readers so that the next writer restarts the WAL from the beginning.
+        Restart,
+        // Like Restart, and also truncate the WAL file to 0 bytes.
+        Truncate
+    };
+
+    /**
+     * \brief When and how the Checkpointer runs checkpoints.
+     */
+    struct CheckpointPolicy
+    {
+        CheckpointMode mode = CheckpointMode::Passive;
+
+        /**
+         * \brief Run a checkpoint once a commit leaves at least this many frames in the WAL.
+         */
+        int64_t walFrames = 1000;
+
+        /**
+         * \brief Maximum time between two checkpoints while the WAL is not empty.
+         */
+        std::chrono::milliseconds interval = std::chrono::seconds(1);
+
+        /**
+         * \brief Busy timeout of the checkpointer connection. Passive checkpoints never wait.
+         */
+        std::chrono::milliseconds busyTimeout = std::chrono::milliseconds(100);
+    };
+
+    /**
+     * \brief Counters of a Checkpointer.
+     */
+    struct CheckpointStats
+    {
+        /**
+         * \brief Number of checkpoints that were run, including those that could not complete.
+         */
+        int64_t checkpoints = 0;
+
+        /**
+         * \brief Number of checkpoints that could not complete because of other connections (SQLITE_BUSY).
+         */
+        int64_t busyCount = 0;
+
+        /**
+         * \brief Number of checkpoints that failed with another error.
+         */
+        int64_t errorCount = 0;
+
+        /**
+         * \brief Total number of frames copied from the WAL into the database file.
+         */
+        int64_t framesCheckpointed = 0;
+
+        /**
+         * \brief Size of the WAL in frames after the last checkpoint.
+         */
+        int64_t walFrames = 0;
+
+        /**
+         * \brief Time spent in the last checkpoint.
+         */
+        std::chrono::nanoseconds lastTime{0};
+
+        /**
+         * \brief Time spent in all checkpoints.
+         */
+        std::chrono::nanoseconds totalTime{0};
+    };
+
+    /**
+     * \brief The Checkpointer class runs WAL checkpoints of a database on its own connection and thread, so that
+     * commits are not slowed down by checkpoints. While a Checkpointer is attached, the automatic checkpoints of the
+     * database connection are disabled. They are restored on destruction.
+     */
+    class Checkpointer
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        Checkpointer() = delete;
+
+        /**
+         * \brief Attach to a database. Throws if the database is not a file database in WAL mode.
+         * \param db Database.
+         * \param p Policy.
+         */
+        Checkpointer(Database& db, const CheckpointPolicy& p);
+
+        Checkpointer(const Checkpointer&) = delete;
+
+        Checkpointer(Checkpointer&&) = delete;
+
+        ~Checkpointer() noexcept;
+
+        Checkpointer& operator=(const Checkpointer&) = delete;
+
+        Checkpointer& operator=(Checkpointer&&) = delete;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] const CheckpointPolicy& getPolicy() const noexcept;
+
+        [[nodiscard]] CheckpointStats getStats() const;
+
+        ////////////////////////////////////////////////////////////////
+        // ...
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Run a checkpoint as soon as possible, regardless of the thresholds. Does not wait for it to finish.
+         */
+        void request();
+
+        /**
+         * \brief Callback that can be passed to sqlite3_wal_hook, with a pointer to a Checkpointer as context.
+         */
+        static int32_t callback(void* context, sqlite3* db, const char* schema, int32_t frames) noexcept;
+
+    private:
+        void run(const std::stop_token& stop);
+
+        void checkpoint();
+
+        /**
+         * \brief Connection to which this checkpointer is attached.
+         */
+        sqlite3* database = nullptr;
+
+        /**
+         * \brief Value of PRAGMA wal_autocheckpoint before this checkpointer was attached.
+         */
+        int32_t autocheckpoint = 0;
+
+        CheckpointPolicy policy;
+
+        /**
+         * \brief Connection that runs the checkpoints.
+         */
+        std::unique_ptr<Database> connection;
+
+        mutable std::mutex mutex;
+
+        std::condition_variable_any condition;
+
+        /**
+         * \brief Size of the WAL in frames, as last reported by a commit or checkpoint.
+         */
+        int64_t walFrames = 0;
+
+        /**
+         * \brief Number of frames at the start of the WAL that were already checkpointed.
+         */
+        int64_t checkpointedFrames = 0;
+
+        bool requested = false;
+
+        CheckpointStats stats;
+
+        std::jthread thread;
+    };
+}  // namespace sql
@@ -6,7 +6,9 @@
 
 #include <concepts>
 #include <memory>
+#include <span>
 #include <string>
+#include <string_view>
 #include <vector>
 
 ////////////////////////////////////////////////////////////////
@@ -270,7 +272,7 @@ namespace sql
             return Column::Type::Int;
         else if constexpr (std::floating_point<T>)
             return Column::Type::Real;
-        else if constexpr (std::same_as<T, std::string>)
+        else if constexpr (std::same_as<T, std::string> || std::same_as<T, std::string_view>)
             return Column::Type::Text;
         else if constexpr (std::is_null_pointer_v<T>)
             return Column::Type::Null;
@@ -288,6 +290,7 @@ namespace sql
     {
         using parameter_t = T;
         using return_t    = T;
+        using view_t      = void;
     };
 
     // Integers can only be retrieved as 32- or 64-bits signed integers.
@@ -296,6 +299,7 @@ namespace sql
     {
         using parameter_t = std::conditional_t<sizeof(T) <= sizeof(int32_t), int32_t, int64_t>;
         using return_t    = T;
+        using view_t      = void;
     };
 
     // Floats and doubles can be retrieved and returned directly.
@@ -304,22 +308,42 @@ namespace sql
     {
         using parameter_t = T;
         using return_t    = T;
+        using view_t      = void;
     };
 
-    // Strings can be retrieved and returned directly.
+    // Strings can be retrieved and returned directly, or viewed as string_views.
     template<std::same_as<std::string> T>
     struct get_column_t<T>
     {
         using parameter_t = std::string;
         using return_t    = std::string;
+        using view_t      = std::string_view;
     };
 
-    // Vectors can be retrieved and returned directly.
+    // Vectors can be retrieved and returned directly, or viewed as spans.
     template<typename T>
     struct get_column_t<std::vector<T>>
     {
         using parameter_t = std::vector<T>;
         using return_t    = std::vector<T>;
+        using view_t      = std::span<const T>;
+    };
+
+    // Views into the row buffer of sqlite can be retrieved and returned directly.
+    template<std::same_as<std::string_view> T>
+    struct get_column_t<T>
+    {
+        using parameter_t = std::string_view;
+        using return_t    = std::string_view;
+        using view_t      = std::string_view;
+    };
+
+    template<typename T>
+    struct get_column_t<std::span<const T>>
+    {
+        using parameter_t = std::span<const T>;
+        using return_t    = std::span<const T>;
+        using view_t      = std::span<const T>;
     };
 
     /**
@@ -335,4 +359,11 @@ namespace sql
      */
     template<typename T>
     using get_column_return_t = typename get_column_t<T>::return_t;
+
+    /**
+     * \brief Convert a type as it is passed to the column type list of a TypedTable to a type that points into the row buffer of sqlite instead of holding a copy (or void if there is none).
+     * \tparam T Column type.
+     */
+    template<typename T>
+    using get_column_view_t = typename get_column_t<T>::view_t;
 }  // namespace sql
\ No newline at end of file
@@ -4,16 +4,35 @@
 // Standard includes.
 ////////////////////////////////////////////////////////////////
 
+#include <array>
+#include <cstddef>
 #include <filesystem>
+#include <functional>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // Current target includes.
 ////////////////////////////////////////////////////////////////
 
+#include "cppql/core/backup.h"
+#include "cppql/core/busy_handler.h"
+#include "cppql/core/cancellation.h"
+#include "cppql/core/checkpointer.h"
+#include "cppql/core/database_options.h"
+#include "cppql/core/progress_handler.h"
+#include "cppql/core/query_plan.h"
+#include "cppql/core/savepoint.h"
+#include "cppql/core/slow_query_log.h"
+#include "cppql/core/sqlite_runtime.h"
 #include "cppql/core/statement.h"
+#include "cppql/core/statement_cache.h"
 #include "cppql/core/table.h"
 #include "cppql/core/transaction.h"
 
@@ -43,17 +62,52 @@ namespace sql
         };
 
         /**
-         * \brief Whether or not to call sqlite3_shutdown on destruction.
+         * \brief Whether or not to call sqlite3_shutdown on destruction. Sqlite is only shut down if no other database
+         * or SqliteRuntime holds a reference to it.
          */
         enum class Shutdown
         {
             // Do not call sqlite3_shutdown.
             Off,
-            // Call sqlite3_shutdown.
+            // Call sqlite3_shutdown if this is the last reference.
             On
         };
 
+        /**
+         * \brief Run time limits of a connection, as passed to sqlite3_limit.
+         */
+        enum class Limit
+        {
+            // Maximum size of a string or blob, or of a row.
+            Length,
+            // Maximum length of SQL code.
+            SqlLength,
+            // Maximum number of columns in a table, index, view, result set, or in ORDER BY and GROUP BY.
+            Column,
+            // Maximum depth of the parse tree of an expression.
+            ExprDepth,
+            // Maximum number of terms in a compound select.
+            CompoundSelect,
+            // Maximum number of instructions of the program of a statement.
+            VdbeOp,
+            // Maximum number of arguments of a function.
+            FunctionArg,
+            // Maximum number of attached databases.
+            Attached,
+            // Maximum length of the pattern of LIKE and GLOB.
+            LikePatternLength,
+            // Maximum index of a parameter.
+            VariableNumber,
+            // Maximum depth of recursive triggers.
+            TriggerDepth,
+            // Maximum number of auxiliary worker threads of a statement.
+            WorkerThreads
+        };
+
+        friend class CancellationScope;
+        friend class Savepoint;
         friend class Statement;
+        friend class Transaction;
 
         Database() = delete;
 
@@ -63,6 +117,13 @@ namespace sql
 
         explicit Database(sqlite3* database);
 
+        /**
+         * \brief Construct from an open database connection and apply options before reading the schema.
+         * \param database Database connection handle.
+         * \param options Options.
+         */
+        Database(sqlite3* database, const DatabaseOptions& options);
+
         ~Database();
 
         Database& operator=(const Database&) = delete;
@@ -81,6 +142,16 @@ namespace sql
          */
         [[nodiscard]] static DatabasePtr create(const std::filesystem::path& file, int32_t flags = 0);
 
+        /**
+         * \brief Create a new database and apply options. Internally calls sqlite3_open_v2.
+         * \param file Path to database file.
+         * \param options Options.
+         * \param flags Additional flags to pass to sqlite3_open_v2.
+         * \return Database.
+         */
+        [[nodiscard]] static DatabasePtr
+          create(const std::filesystem::path& file, const DatabaseOptions& options, int32_t flags = 0);
+
         /**
          * \brief Open an existing database. Internally calls sqlite3_open_v2.
          * \param file Path to database file.
@@ -89,6 +160,16 @@ namespace sql
          */
         [[nodiscard]] static DatabasePtr open(const std::filesystem::path& file, int32_t flags = 0);
 
+        /**
+         * \brief Open an existing database and apply options. Internally calls sqlite3_open_v2.
+         * \param file Path to database file.
+         * \param options Options.
+         * \param flags Additional flags to pass to sqlite3_open_v2.
+         * \return Database.
+         */
+        [[nodiscard]] static DatabasePtr
+          open(const std::filesystem::path& file, const DatabaseOptions& options, int32_t flags = 0);
+
         /**
          * \brief Open an existing database or create one if it does not exist. Internally calls sqlite3_open_v2.
          * \param file Path to database file.
@@ -98,6 +179,27 @@ namespace sql
         [[nodiscard]] static std::pair<DatabasePtr, bool> openOrCreate(const std::filesystem::path& file,
                                                                        int32_t                      flags = 0);
 
+        /**
+         * \brief Open an existing database or create one if it does not exist, and apply options. Internally calls
+         * sqlite3_open_v2.
+         * \param file Path to database file.
+         * \param options Options.
+         * \param flags Additional flags to pass to sqlite3_open_v2.
+         * \return Database and boolean indicating whether a new database was created.
+         */
+        [[nodiscard]] static std::pair<DatabasePtr, bool>
+          openOrCreate(const std::filesystem::path& file, const DatabaseOptions& options, int32_t flags = 0);
+
+        /**
+         * \brief Open an in-memory database from a serialized database, as returned by serialize. The data is
+         * copied, so it can be reused to open any number of independent databases.
+         * \param data Serialized database.
+         * \param options Options.
+         * \return Database.
+         */
+        [[nodiscard]] static DatabasePtr deserialize(std::span<const std::byte> data,
+                                                     const DatabaseOptions&     options = {});
+
         ////////////////////////////////////////////////////////////////
         // Getters.
         ////////////////////////////////////////////////////////////////
@@ -120,8 +222,21 @@ namespace sql
          */
         [[nodiscard]] Shutdown getShutdown() const noexcept;
 
+        /**
+         * \brief Get table. With SchemaLoading::Lazy, the table definition is read from the database on first
+         * access, together with the tables it references through foreign keys.
+         * \param name Table name. Tables in attached databases are named "alias.table".
+         * \return Table.
+         */
         [[nodiscard]] Table& getTable(const std::string& name);
 
+        /**
+         * \brief Check if a database is attached under the given alias.
+         * \param alias Alias.
+         * \return True if attached.
+         */
+        [[nodiscard]] bool isAttached(const std::string& alias) const;
+
         [[nodiscard]] int64_t getLastInsertRowId() const noexcept;
 
         /**
@@ -142,6 +257,82 @@ namespace sql
          */
         [[nodiscard]] std::string getErrorMessage() const;
 
+        /**
+         * \brief Get cache of prepared statements. Disabled by default. Use StatementCache::setCapacity to enable.
+         * \return StatementCache.
+         */
+        [[nodiscard]] StatementCache& getStatementCache() noexcept;
+
+        /**
+         * \brief Get cache of prepared statements.
+         * \return StatementCache.
+         */
+        [[nodiscard]] const StatementCache& getStatementCache() const noexcept;
+
+        /**
+         * \brief Read the current value of all settings covered by DatabaseOptions from the connection.
+         * \return DatabaseOptions. Fields for settings that are not supported by this build of sqlite are not set.
+         */
+        [[nodiscard]] DatabaseOptions getOptions();
+
+        /**
+         * \brief Get the number of unused pages in the database file. These can be removed with vacuum, or with
+         * incrementalVacuum if auto vacuum is set to AutoVacuum::Incremental.
+         * \return Number of pages.
+         */
+        [[nodiscard]] int64_t getFreePageCount();
+
+        /**
+         * \brief Get busy handler installed by setBusyPolicy.
+         * \return BusyHandler, or nullptr if there is no busy policy.
+         */
+        [[nodiscard]] BusyHandler* getBusyHandler() const noexcept;
+
+        /**
+         * \brief Get busy handler counters, such as the total time spent waiting for locks.
+         * \return BusyStats. All zero if there is no busy policy.
+         */
+        [[nodiscard]] BusyStats getBusyStats() const noexcept;
+
+        /**
+         * \brief Get runtime counters of this connection, such as page cache hits and memory usage. Internally calls
+         * sqlite3_db_status.
+         * \param reset If true, reset the counters that support it after reading them.
+         * \return DatabaseStats.
+         */
+        [[nodiscard]] DatabaseStats getStats(bool reset = false) const;
+
+        /**
+         * \brief Get slow query log installed by setSlowQueryLog.
+         * \return SlowQueryLog, or nullptr if there is none.
+         */
+        [[nodiscard]] const SlowQueryLog* getSlowQueryLog() const noexcept;
+
+        /**
+         * \brief Get checkpointer installed by setCheckpointer.
+         * \return Checkpointer, or nullptr if there is none.
+         */
+        [[nodiscard]] Checkpointer* getCheckpointer() const noexcept;
+
+        /**
+         * \brief Get a run time limit. Internally calls sqlite3_limit.
+         * \param limit Limit.
+         * \return Value.
+         */
+        [[nodiscard]] int32_t getLimit(Limit limit) const noexcept;
+
+        /**
+         * \brief Get the memory used by the page cache and the prepared statements of this connection.
+         * \return ConnectionMemory.
+         */
+        [[nodiscard]] ConnectionMemory getMemoryUsage() const;
+
+        /**
+         * \brief Get memory budget installed by setMemoryBudget.
+         * \return MemoryBudget, or std::nullopt if there is none.
+         */
+        [[nodiscard]] const std::optional<MemoryBudget>& getMemoryBudget() const noexcept;
+
         ////////////////////////////////////////////////////////////////
         // Setters.
         ////////////////////////////////////////////////////////////////
@@ -158,27 +349,304 @@ namespace sql
          */
         void setShutdown(Shutdown value) noexcept;
 
+        /**
+         * \brief Install a busy handler that retries with jittered exponential backoff when the database is locked.
+         * Replaces any busy timeout. Internally calls sqlite3_busy_handler.
+         * \param policy BusyPolicy.
+         */
+        void setBusyPolicy(const BusyPolicy& policy);
+
+        /**
+         * \brief Remove the busy handler. Locked operations fail immediately with SQLITE_BUSY afterwards.
+         */
+        void clearBusyPolicy();
+
+        /**
+         * \brief Record all statement executions that take at least threshold. Records include the code with the
+         * bound values, the wall time and the number of returned rows. Replaces any previous slow query log.
+         * Internally calls sqlite3_trace_v2.
+         * \param threshold Minimum duration of statements to record. 0 records all statements. Note that sqlite
+         * measures durations with the clock of the VFS, which usually has millisecond resolution.
+         * \param sink Sink that receives the records.
+         */
+        void setSlowQueryLog(std::chrono::nanoseconds threshold, SlowQuerySinkPtr sink);
+
+        /**
+         * \brief Stop recording slow queries.
+         */
+        void clearSlowQueryLog();
+
+        /**
+         * \brief Run WAL checkpoints on a background thread with its own connection, instead of on commit. Replaces
+         * any previous checkpointer. The database must be a file database in WAL mode.
+         * \param policy Policy.
+         */
+        void setCheckpointer(const CheckpointPolicy& policy);
+
+        /**
+         * \brief Stop the checkpointer installed by setCheckpointer and restore automatic checkpoints.
+         */
+        void clearCheckpointer();
+
+        /**
+         * \brief Invoke a callback periodically during long running statements. If it returns true, the running
+         * statement is interrupted and fails with an InterruptError. Replaces any previous callback. Internally calls
+         * sqlite3_progress_handler.
+         * \param instructions Number of virtual machine instructions between two invocations.
+         * \param callback Callback.
+         */
+        void setProgressHandler(int32_t instructions, std::function<bool()> callback);
+
+        /**
+         * \brief Remove the callback installed by setProgressHandler.
+         */
+        void clearProgressHandler();
+
+        /**
+         * \brief Set a run time limit. Values above the compile time maximum are truncated. Internally calls
+         * sqlite3_limit.
+         * \param limit Limit.
+         * \param value New value. Must not be negative.
+         * \return Previous value.
+         */
+        int32_t setLimit(Limit limit, int32_t value);
+
+        /**
+         * \brief Check the memory used by this connection periodically and invoke a callback when it exceeds a budget.
+         * Replaces any previous budget.
+         * \param budget MemoryBudget.
+         */
+        void setMemoryBudget(MemoryBudget budget);
+
+        /**
+         * \brief Remove the memory budget.
+         */
+        void clearMemoryBudget() noexcept;
+
+        /**
+         * \brief Apply options to the connection. Options are applied in an order that respects the dependencies
+         * between them, e.g. page_size before journal_mode. Note that some options, such as page_size, have no
+         * effect on a database that already contains data.
+         * \param options Options.
+         */
+        void applyOptions(const DatabaseOptions& options);
+
         ////////////////////////////////////////////////////////////////
         // ...
         ////////////////////////////////////////////////////////////////
 
+        /**
+         * \brief Interrupt all statements that are running on this connection. They fail with an InterruptError. Can
+         * be called from any thread. Internally calls sqlite3_interrupt.
+         */
+        void interrupt() noexcept;
+
+        /**
+         * \brief Free as much page cache memory of this connection as possible, e.g. while it is idle. Pages that are
+         * in use by open transactions are kept. Internally calls sqlite3_db_release_memory.
+         * \return Number of bytes that were freed.
+         */
+        int64_t releaseMemory();
+
+        /**
+         * \brief Check the memory budget now, instead of waiting for the next periodic check. Invokes the callback of
+         * the budget if it is exceeded.
+         * \return True if the budget was exceeded.
+         */
+        bool checkMemoryBudget();
+
         Statement createStatement(std::string code, bool prepare);
 
+        /**
+         * \brief Create a new table. Prefix the name with "alias." to create the table in an attached database.
+         * \param name Table name.
+         * \return Table.
+         */
         Table& createTable(const std::string& name);
 
         Table& registerTable(const std::string& name);
 
         void dropTable(const std::string& name);
 
-        [[nodiscard]] Transaction beginTransaction(Transaction::Type type);
+        /**
+         * \brief Attach another database file to this connection. Its tables are read according to the schema
+         * loading mode of this database and can be retrieved as "alias.table". Queries on them emit schema-qualified
+         * names, so they can be joined with tables of the main database. Queries that are compiled against another
+         * connection require the same file to be attached there under the same alias.
+         * \param file Path to database file. Created if it does not exist.
+         * \param alias Alias. Must be a plain identifier.
+         */
+        void attach(const std::filesystem::path& file, const std::string& alias);
+
+        /**
+         * \brief Detach a database. All Table objects of the attached database are invalidated.
+         * \param alias Alias.
+         */
+        void detach(const std::string& alias);
+
+        /**
+         * \brief Begin a transaction.
+         * \param type Transaction type.
+         * \param retries Number of times to retry if the database is busy.
+         * \return Transaction.
+         */
+        [[nodiscard]] Transaction beginTransaction(Transaction::Type type, size_t retries = 0);
+
+        /**
+         * \brief Begin a deferred transaction that reads from a snapshot captured on another connection to the same
+         * database. Requires CPPQL_ENABLE_SNAPSHOT.
+         * \param snapshot Snapshot.
+         * \return Transaction.
+         */
+        [[nodiscard]] Transaction beginTransaction(const Snapshot& snapshot);
+
+        /**
+         * \brief Open a savepoint. Can be nested inside of a transaction or another savepoint.
+         * \return Savepoint.
+         */
+        [[nodiscard]] Savepoint beginSavepoint();
 
         /**
          * \brief Execute the VACUUM command.
          */
         void vacuum();
 
+        /**
+         * \brief Write a vacuumed copy of this database to a file. Unlike vacuum, this only needs a read transaction.
+         * In WAL mode other connections can therefore keep reading and writing. In rollback journal mode the read
+         * transaction holds a shared lock, so other connections can read, but cannot commit writes until the copy is
+         * done. The copy does not include uncommitted changes.
+         * \param file Path to destination file. Must not exist yet or be empty.
+         */
+        void vacuumInto(const std::filesystem::path& file);
+
+        /**
+         * \brief Remove up to maxPages unused pages from the database file. Cheap enough to run in small steps from a
+         * maintenance timer. Only has an effect if auto vacuum is set to AutoVacuum::Incremental.
+         * \param maxPages Maximum number of pages to remove. If <= 0, all unused pages are removed.
+         * \return Number of pages that were removed.
+         */
+        int64_t incrementalVacuum(int64_t maxPages = 0);
+
+        /**
+         * \brief Get the query plan sqlite chooses for a statement, without running it. Unbound parameters are
+         * treated as NULL.
+         * \param code SQL code of a single statement, without the EXPLAIN QUERY PLAN prefix.
+         * \return QueryPlan.
+         */
+        [[nodiscard]] QueryPlan explain(const std::string& code);
+
+        /**
+         * \brief Copy this database to a file while it remains in use. Pages are copied in steps, and the source
+         * database is only locked during a step. Changes made through other connections restart the backup, changes
+         * made through this connection are copied along. Internally uses the sqlite3_backup API.
+         * \param file Path to destination file. Overwritten if it exists.
+         * \param options Options.
+         */
+        void backupTo(const std::filesystem::path& file, const BackupOptions& options = {});
+
+        /**
+         * \brief Copy this database into another database while it remains in use. The table definitions of the
+         * destination are reread afterwards, so Table objects previously retrieved from it are invalidated.
+         * \param destination Destination database.
+         * \param options Options.
+         */
+        void backupTo(Database& destination, const BackupOptions& options = {});
+
+        /**
+         * \brief Serialize the database into a buffer. The result holds the same bytes as the database file would.
+         * Internally calls sqlite3_serialize.
+         * \return Serialized database.
+         */
+        [[nodiscard]] std::vector<std::byte> serialize() const;
+
+        /**
+         * \brief Get the memory of a database that was opened with deserialize without making a copy. The returned
+         * span is invalidated by any change to the database. Internally calls sqlite3_serialize with
+         * SQLITE_SERIALIZE_NOCOPY.
+         * \return Serialized database, or an empty span if the database is not stored in contiguous memory (e.g. a
+         * file or a regular in-memory database).
+         */
+        [[nodiscard]] std::span<const std::byte> serializeNoCopy() const noexcept;
+
     private:
-        void initializeTables();
+        /**
+         * \brief Read tables of the main database or an attached database.
+         * \param schema Alias of the attached database. Empty for the main database.
+         */
+        void initializeTables(const std::string& schema = {});
+
+        /**
+         * \brief Split a table name into the alias of an attached database and the unqualified table name.
+         * \param name Table name, optionally prefixed with "alias.".
+         * \return Alias (empty if the table is in the main database) and table name.
+         */
+        [[nodiscard]] std::pair<std::string, std::string> splitTableName(const std::string& name) const;
+
+        /**
+         * \brief Read definition of a table that was not read yet, and of all tables it references.
+         * \param name Table name.
+         * \return Table.
+         */
+        Table& loadTable(const std::string& name);
+
+        /**
+         * \brief Execute "PRAGMA name=value;".
+         */
+        void setPragma(const std::string& name, const std::string& value);
+
+        /**
+         * \brief Execute "PRAGMA name;" and return the first column of the result, or std::nullopt if there is none.
+         */
+        template<typename T>
+        [[nodiscard]] std::optional<T> getPragma(const std::string& name);
+
+        /**
+         * \brief Run a persistent statement. The statement is prepared on first use and kept until this database is
+         * destroyed. It is reset after running, so that it does not hold on to any locks.
+         * \param code SQL code.
+         * \return Result of stepping the statement.
+         */
+        [[nodiscard]] Result runPersistent(const std::string& code);
+
+        /**
+         * \brief Count a statement reset towards the next periodic memory budget check.
+         */
+        void countStatementReset() noexcept;
+
+        void pushCancellationScope(const CancellationScope& scope);
+
+        void popCancellationScope(const CancellationScope& scope) noexcept;
+
+        /**
+         * \brief Install or remove the sqlite progress handler, depending on whether it has anything to do.
+         */
+        void updateProgressHandler() noexcept;
+
+        /**
+         * \brief Check the active cancellation scopes.
+         * \return Reason, or std::nullopt if statements can continue.
+         */
+        [[nodiscard]] std::optional<InterruptReason> checkCancellation() const noexcept;
+
+        /**
+         * \brief Get why the last statement was interrupted.
+         * \return Reason.
+         */
+        [[nodiscard]] InterruptReason takeInterruptReason() noexcept;
+
+        /**
+         * \brief Get code to open, release and roll back the savepoint at the given depth.
+         * \param depth Depth.
+         * \return SAVEPOINT, RELEASE and ROLLBACK TO statements.
+         */
+        [[nodiscard]] const std::array<std::string, 3>& getSavepointCode(size_t depth);
+
+        /**
+         * \brief Reference to the process wide state of sqlite. Declared first, so that it is released after the
+         * connection is closed.
+         */
+        SqliteRuntime runtime;
 
         /**
          * \brief Handle to sqlite database connection.
@@ -199,6 +667,67 @@ namespace sql
         Shutdown shutdown = Shutdown::On;
 #endif
 
+        /**
+         * \brief Tables by name. Tables of attached databases are stored as "alias.table".
+         */
         std::unordered_map<std::string, TablePtr> tables;
+
+        /**
+         * \brief Names of tables that exist in the database but whose definition was not read yet.
+         */
+        std::unordered_set<std::string> unloadedTables;
+
+        SchemaLoading schemaLoading = SchemaLoading::Eager;
+
+        /**
+         * \brief Aliases of attached databases.
+         */
+        std::unordered_set<std::string> attachedSchemas;
+
+        /**
+         * \brief Prepared statements that were released by Statement objects, to be reused by new Statement objects
+         * with the same code.
+         */
+        StatementCache statementCache;
+
+        /**
+         * \brief Busy handler. Heap allocated because sqlite keeps a pointer to it, which must survive moves.
+         */
+        std::unique_ptr<BusyHandler> busyHandler;
+
+        /**
+         * \brief Slow query log. Heap allocated because sqlite keeps a pointer to it, which must survive moves.
+         */
+        std::unique_ptr<SlowQueryLog> slowQueryLog;
+
+        std::unique_ptr<Checkpointer> checkpointer;
+
+        /**
+         * \brief Progress handler. Heap allocated because sqlite keeps a pointer to it, which must survive moves.
+         * Created on first use.
+         */
+        std::unique_ptr<ProgressHandler> progressHandler;
+
+        std::optional<MemoryBudget> memoryBudget;
+
+        /**
+         * \brief Number of statement resets until the next memory budget check.
+         */
+        int32_t budgetCountdown = 0;
+
+        /**
+         * \brief Frequently used statements with fixed code, such as BEGIN and COMMIT, by code.
+         */
+        std::unordered_map<std::string, StatementPtr> persistentStatements;
+
+        /**
+         * \brief Code of savepoint statements, by depth.
+         */
+        std::vector<std::array<std::string, 3>> savepointCode;
+
+        /**
+         * \brief Number of open savepoints.
+         */
+        size_t savepointDepth = 0;
     };
 }  // namespace sql
@@ -0,0 +1,175 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/busy_handler.h"
+#include "cppql/core/memory_config.h"
+
+namespace sql
+{
+    /**
+     * \brief Value of PRAGMA journal_mode.
+     */
+    enum class JournalMode
+    {
+        Delete,
+        Truncate,
+        Persist,
+        Memory,
+        Wal,
+        Off
+    };
+
+    /**
+     * \brief Value of PRAGMA synchronous.
+     */
+    enum class Synchronous
+    {
+        Off,
+        Normal,
+        Full,
+        Extra
+    };
+
+    /**
+     * \brief Value of PRAGMA temp_store.
+     */
+    enum class TempStore
+    {
+        Default,
+        File,
+        Memory
+    };
+
+    /**
+     * \brief Value of PRAGMA locking_mode.
+     */
+    enum class LockingMode
+    {
+        Normal,
+        Exclusive
+    };
+
+    /**
+     * \brief Value of PRAGMA auto_vacuum.
+     */
+    enum class AutoVacuum
+    {
+        // Freed pages are kept in the file until the next VACUUM.
+        None,
+        // Freed pages are removed from the file on every commit.
+        Full,
+        // Freed pages are kept in the file until Database::incrementalVacuum is called.
+        Incremental
+    };
+
+    /**
+     * \brief When to read table definitions from the database schema.
+     */
+    enum class SchemaLoading
+    {
+        // Read all tables when opening the database.
+        Eager,
+        // Only read table names when opening the database. Tables are read on first access through
+        // Database::getTable or Database::registerTable.
+        Lazy
+    };
+
+    [[nodiscard]] std::string toString(JournalMode value);
+
+    [[nodiscard]] std::string toString(Synchronous value);
+
+    [[nodiscard]] std::string toString(TempStore value);
+
+    [[nodiscard]] std::string toString(LockingMode value);
+
+    [[nodiscard]] std::string toString(AutoVacuum value);
+
+    void fromString(const std::string& s, JournalMode& value);
+
+    void fromString(const std::string& s, LockingMode& value);
+
+    /**
+     * \brief The DatabaseOptions struct holds connection settings that are applied when opening a database. Every
+     * field maps onto the PRAGMA of the same name. Fields that are not set leave the sqlite default (or the value
+     * stored in the database file) untouched.
+     */
+    struct DatabaseOptions
+    {
+        /**
+         * \brief Journal mode. Persistent for WAL mode. Cannot be applied to in-memory databases.
+         */
+        std::optional<JournalMode> journalMode;
+
+        std::optional<Synchronous> synchronous;
+
+        /**
+         * \brief Size of the page cache. Positive values are a number of pages, negative values a number of KiB.
+         */
+        std::optional<int64_t> cacheSize;
+
+        /**
+         * \brief Page size in bytes. Only has an effect on databases that are still empty, and cannot be changed once
+         * in WAL mode. It is therefore applied before all other options.
+         */
+        std::optional<int64_t> pageSize;
+
+        /**
+         * \brief Auto vacuum mode. Switching between Full and Incremental is always possible. Switching from or to
+         * None only has an effect on databases that are still empty, or after the next call to Database::vacuum.
+         */
+        std::optional<AutoVacuum> autoVacuum;
+
+        /**
+         * \brief Maximum number of bytes of the database file that are memory-mapped.
+         */
+        std::optional<int64_t> mmapSize;
+
+        std::optional<TempStore> tempStore;
+
+        std::optional<LockingMode> lockingMode;
+
+        /**
+         * \brief Enforce foreign key constraints.
+         */
+        std::optional<bool> foreignKeys;
+
+        /**
+         * \brief Time to keep retrying when a table is locked. Internally calls sqlite3_busy_timeout.
+         */
+        std::optional<std::chrono::milliseconds> busyTimeout;
+
+        /**
+         * \brief Busy handler with exponential backoff. Takes precedence over busyTimeout.
+         */
+        std::optional<BusyPolicy> busyPolicy;
+
+        /**
+         * \brief Number of WAL frames after which a checkpoint is run automatically. 0 disables automatic
+         * checkpoints.
+         */
+        std::optional<int64_t> walAutocheckpoint;
+
+        /**
+         * \brief Lookaside memory of the connection. Overrides MemoryConfig::lookaside. Only used when opening a
+         * database.
+         */
+        std::optional<Lookaside> lookaside;
+
+        /**
+         * \brief When to read table definitions. Only used when opening a database. Defaults to SchemaLoading::Eager.
+         */
+        std::optional<SchemaLoading> schemaLoading;
+    };
+}  // namespace sql
@@ -0,0 +1,190 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <condition_variable>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/database.h"
+
+namespace sql
+{
+    class DatabasePool;
+    using DatabasePoolPtr = std::unique_ptr<DatabasePool>;
+
+    /**
+     * \brief The DatabasePool class manages a set of connections to the same database file. There is a single
+     * writer connection and a configurable number of read-only connections. The database is put in WAL mode, so
+     * that readers do not block the writer and vice versa. Connections are handed out through Lease objects, which
+     * return the connection to the pool on destruction.
+     */
+    class DatabasePool
+    {
+    public:
+        /**
+         * \brief Exclusive handle to one of the connections of a DatabasePool. While a Lease is alive, no other
+         * Lease to the same connection is handed out. Statements compiled against the leased connection must be
+         * destroyed before the Lease is.
+         */
+        class Lease
+        {
+        public:
+            friend class DatabasePool;
+
+            Lease() = delete;
+
+            Lease(const Lease&) = delete;
+
+            Lease(Lease&& other) noexcept;
+
+            ~Lease() noexcept;
+
+            Lease& operator=(const Lease&) = delete;
+
+            Lease& operator=(Lease&& other) noexcept;
+
+            /**
+             * \brief Get leased connection.
+             * \return Database.
+             */
+            [[nodiscard]] Database& get() const noexcept;
+
+            [[nodiscard]] Database& operator*() const noexcept;
+
+            [[nodiscard]] Database* operator->() const noexcept;
+
+            /**
+             * \brief Returns true if this Lease holds the writer connection.
+             * \return True if writer.
+             */
+            [[nodiscard]] bool isWriter() const noexcept;
+
+            /**
+             * \brief Return connection to pool. Called automatically on destruction.
+             */
+            void release() noexcept;
+
+        private:
+            Lease(DatabasePool& p, Database& database, size_t idx);
+
+            /**
+             * \brief Pool this Lease was handed out by.
+             */
+            DatabasePool* pool = nullptr;
+
+            /**
+             * \brief Leased connection.
+             */
+            Database* db = nullptr;
+
+            /**
+             * \brief Index of reader connection, or writer_index for the writer connection.
+             */
+            size_t index = 0;
+        };
+
+        friend class Lease;
+
+        DatabasePool() = delete;
+
+        /**
+         * \brief Open (or create) the database file and open the writer and reader connections. Enables WAL mode.
+         * \param file Path to database file. Cannot be an in-memory database.
+         * \param readerCount Number of read-only connections.
+         * \param flags Additional flags to pass to sqlite3_open_v2 for all connections.
+         */
+        DatabasePool(const std::filesystem::path& file, size_t readerCount, int32_t flags = 0);
+
+        DatabasePool(const DatabasePool&) = delete;
+
+        DatabasePool(DatabasePool&&) = delete;
+
+        ~DatabasePool() noexcept;
+
+        DatabasePool& operator=(const DatabasePool&) = delete;
+
+        DatabasePool& operator=(DatabasePool&&) = delete;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get number of read-only connections.
+         * \return Number of readers.
+         */
+        [[nodiscard]] size_t getReaderCount() const noexcept;
+
+        /**
+         * \brief Get number of read-only connections that are currently not leased.
+         * \return Number of available readers.
+         */
+        [[nodiscard]] size_t getAvailableReaderCount() const;
+
+        ////////////////////////////////////////////////////////////////
+        // Leases.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Lease the writer connection. Blocks until the writer is available.
+         * \return Lease.
+         */
+        [[nodiscard]] Lease writer();
+
+        /**
+         * \brief Try to lease the writer connection without blocking.
+         * \return Lease, or std::nullopt if the writer is in use.
+         */
+        [[nodiscard]] std::optional<Lease> tryWriter();
+
+        /**
+         * \brief Lease a read-only connection. Blocks until a reader is available.
+         * \return Lease.
+         */
+        [[nodiscard]] Lease reader();
+
+        /**
+         * \brief Try to lease a read-only connection without blocking.
+         * \return Lease, or std::nullopt if all readers are in use.
+         */
+        [[nodiscard]] std::optional<Lease> tryReader();
+
+    private:
+        static constexpr size_t writer_index = static_cast<size_t>(-1);
+
+        void release(size_t index) noexcept;
+
+        /**
+         * \brief Writer connection. Declared before readers so that it is destroyed last.
+         */
+        DatabasePtr writerDb;
+
+        /**
+         * \brief Read-only connections.
+         */
+        std::vector<DatabasePtr> readers;
+
+        /**
+         * \brief Indices of readers that are not leased.
+         */
+        std::vector<size_t> available;
+
+        bool writerLeased = false;
+
+        mutable std::mutex mutex;
+
+        std::condition_variable readerCondition;
+
+        std::condition_variable writerCondition;
+    };
+}  // namespace sql
@@ -0,0 +1,226 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+struct sqlite3_mem_methods;
+
+namespace sql
+{
+    class Database;
+
+    /**
+     * \brief Preallocated memory for the page caches of all connections. Pages that do not fit are allocated on the
+     * heap.
+     */
+    struct PageCacheArena
+    {
+        /**
+         * \brief Largest page size of all databases that will be opened. Space for the page header is added
+         * automatically.
+         */
+        int32_t pageSize = 4096;
+
+        /**
+         * \brief Number of pages. 0 disables the arena.
+         */
+        int32_t pages = 0;
+    };
+
+    /**
+     * \brief Preallocated memory from which sqlite serves all of its allocations. Allocations fail with SQLITE_NOMEM
+     * once the arena is exhausted.
+     *
+     * By default, the arena is managed by an allocator of this library. Allocations are rounded up to a power of two
+     * and carved from the arena. Freed blocks are reused only for allocations of the same rounded size and are never
+     * merged, so the arena should have room for the peak usage of each size. When built with CPPQL_ENABLE_MEMSYS5, the
+     * arena is handed to the MEMSYS5 allocator of sqlite instead, which requires sqlite compiled with
+     * SQLITE_ENABLE_MEMSYS5.
+     */
+    struct HeapArena
+    {
+        /**
+         * \brief Size in bytes. 0 restores the default allocator.
+         */
+        size_t size = 0;
+
+        /**
+         * \brief Minimum allocation size in bytes. Rounded up to a power of two. The allocator of this library uses at
+         * least 16 bytes, 8 of which hold the size of the allocation.
+         */
+        int32_t minAllocation = 0;
+    };
+
+    /**
+     * \brief Lookaside memory of a connection, which serves small allocations (e.g. while preparing and running
+     * statements) without going through the heap. Allocated as a single block when the connection is opened.
+     */
+    struct Lookaside
+    {
+        /**
+         * \brief Size of each slot in bytes. Rounded down to a multiple of 8.
+         */
+        int32_t slotSize = 1200;
+
+        /**
+         * \brief Number of slots. 0 disables lookaside memory.
+         */
+        int32_t slots = 100;
+    };
+
+    /**
+     * \brief Process wide memory settings of sqlite.
+     */
+    struct MemoryConfig
+    {
+        std::optional<PageCacheArena> pageCache;
+
+        std::optional<HeapArena> heap;
+
+        /**
+         * \brief Custom allocator. The struct is copied by sqlite. Ignored if heap is set.
+         */
+        const sqlite3_mem_methods* allocator = nullptr;
+
+        /**
+         * \brief Default lookaside memory of new connections. Can be overridden per connection with
+         * DatabaseOptions::lookaside.
+         */
+        std::optional<Lookaside> lookaside;
+
+        /**
+         * \brief Collect memory statistics. Required for getMemoryStats. Enabled by default.
+         */
+        std::optional<bool> memoryStatus;
+    };
+
+    /**
+     * \brief Process wide memory usage of sqlite, as reported by sqlite3_status64.
+     */
+    struct MemoryStats
+    {
+        /**
+         * \brief Bytes of memory currently allocated by sqlite, excluding the page cache arena.
+         */
+        int64_t memoryUsed = 0;
+
+        /**
+         * \brief Highest value of memoryUsed.
+         */
+        int64_t memoryHighwater = 0;
+
+        /**
+         * \brief Number of outstanding allocations.
+         */
+        int64_t mallocCount = 0;
+
+        /**
+         * \brief Largest allocation request in bytes.
+         */
+        int64_t largestAllocation = 0;
+
+        /**
+         * \brief Number of pages currently used from the page cache arena.
+         */
+        int64_t pageCacheUsed = 0;
+
+        /**
+         * \brief Bytes of page cache that did not fit into the page cache arena and were allocated on the heap.
+         */
+        int64_t pageCacheOverflow = 0;
+    };
+
+    /**
+     * \brief Memory used by a single connection, as reported by sqlite3_db_status.
+     */
+    struct ConnectionMemory
+    {
+        /**
+         * \brief Bytes of heap memory used by the page cache.
+         */
+        int64_t cacheUsed = 0;
+
+        /**
+         * \brief Bytes of heap memory used by all prepared statements, including those in the StatementCache.
+         */
+        int64_t statementUsed = 0;
+    };
+
+    /**
+     * \brief Memory budget of a single connection. The budget is checked after statements are reset, and the callback
+     * is invoked when the connection uses more memory than allowed.
+     */
+    struct MemoryBudget
+    {
+        /**
+         * \brief Maximum bytes of page cache. 0 for no limit.
+         */
+        int64_t cacheBytes = 0;
+
+        /**
+         * \brief Maximum bytes of prepared statements. 0 for no limit.
+         */
+        int64_t statementBytes = 0;
+
+        /**
+         * \brief Check the budget once every this many statement resets. Measuring statement memory requires a walk
+         * over all prepared statements, so checking after every statement can be expensive.
+         */
+        int32_t checkInterval = 100;
+
+        /**
+         * \brief Invoked when the budget is exceeded. Exceptions thrown from automatic checks are ignored. If empty,
+         * the StatementCache is cleared when statement memory is over budget, and Database::releaseMemory is called.
+         */
+        std::function<void(Database& db, const ConnectionMemory& usage)> callback;
+    };
+
+    /**
+     * \brief Apply memory settings. Must be called before sqlite is initialized, i.e. before the first database is
+     * opened, or after sqlite3_shutdown. Arenas are allocated here and kept alive until the next call. See also
+     * RuntimeConfig::memory.
+     * \param config Settings. Fields that are not set are left unchanged.
+     */
+    void configureMemory(const MemoryConfig& config);
+
+    /**
+     * \brief Get process wide memory usage.
+     * \param reset If true, reset the highwater marks.
+     * \return MemoryStats.
+     */
+    [[nodiscard]] MemoryStats getMemoryStats(bool reset = false);
+
+    /**
+     * \brief Set the process wide soft heap limit. Once sqlite uses more memory, it releases page cache memory of all
+     * connections before allocating more. Internally calls sqlite3_soft_heap_limit64.
+     * \param bytes Limit in bytes. 0 for no limit.
+     * \return Previous limit.
+     */
+    int64_t setSoftHeapLimit(int64_t bytes);
+
+    /**
+     * \brief Get the process wide soft heap limit.
+     * \return Limit in bytes. 0 if there is no limit.
+     */
+    [[nodiscard]] int64_t getSoftHeapLimit() noexcept;
+
+    /**
+     * \brief Set the process wide hard heap limit. Allocations that would exceed it fail with SQLITE_NOMEM.
+     * Internally calls sqlite3_hard_heap_limit64.
+     * \param bytes Limit in bytes. 0 for no limit.
+     * \return Previous limit.
+     */
+    int64_t setHardHeapLimit(int64_t bytes);
+
+    /**
+     * \brief Get the process wide hard heap limit.
+     * \return Limit in bytes. 0 if there is no limit.
+     */
+    [[nodiscard]] int64_t getHardHeapLimit() noexcept;
+}  // namespace sql
@@ -0,0 +1,121 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <vector>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/interrupt_error.h"
+
+namespace sql
+{
+    class CancellationScope;
+
+    /**
+     * \brief The ProgressHandler class implements a sqlite progress handler that interrupts statements when a
+     * CancellationScope expires or a user callback asks for it, and remembers why.
+     */
+    class ProgressHandler
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        ProgressHandler() = default;
+
+        ProgressHandler(const ProgressHandler&) = delete;
+
+        ProgressHandler(ProgressHandler&&) = delete;
+
+        ~ProgressHandler() noexcept = default;
+
+        ProgressHandler& operator=(const ProgressHandler&) = delete;
+
+        ProgressHandler& operator=(ProgressHandler&&) = delete;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get the number of virtual machine instructions between two invocations.
+         * \return Number of instructions.
+         */
+        [[nodiscard]] int32_t getInstructions() const noexcept;
+
+        /**
+         * \brief Check whether there is a callback or an active CancellationScope.
+         * \return True if sqlite should invoke this handler.
+         */
+        [[nodiscard]] bool isActive() const noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Setters.
+        ////////////////////////////////////////////////////////////////
+
+        void setCallback(int32_t instructions, std::function<bool()> f);
+
+        void clearCallback() noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Scopes.
+        ////////////////////////////////////////////////////////////////
+
+        void pushScope(const CancellationScope& scope);
+
+        void popScope(const CancellationScope& scope) noexcept;
+
+        /**
+         * \brief Check all active scopes, from the innermost to the outermost.
+         * \return Reason of the first scope that must stop, or std::nullopt.
+         */
+        [[nodiscard]] std::optional<InterruptReason> checkScopes() const noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // ...
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get why the last statement was interrupted and forget it.
+         * \return Reason. InterruptReason::Interrupt if this handler did not interrupt it.
+         */
+        [[nodiscard]] InterruptReason takeReason() noexcept;
+
+        /**
+         * \brief Check scopes and the callback.
+         * \return True to interrupt the running statement.
+         */
+        bool progress() noexcept;
+
+        /**
+         * \brief Callback that can be passed to sqlite3_progress_handler, with a pointer to a ProgressHandler as
+         * argument.
+         * \param handler ProgressHandler.
+         * \return Nonzero to interrupt.
+         */
+        static int32_t callback(void* handler) noexcept;
+
+    private:
+        std::function<bool()> userCallback;
+
+        int32_t instructions = default_instructions;
+
+        std::vector<const CancellationScope*> scopes;
+
+        std::optional<InterruptReason> reason;
+
+        /**
+         * \brief Number of instructions between two invocations when there is only a CancellationScope.
+         */
+        static constexpr int32_t default_instructions = 1000;
+    };
+}  // namespace sql
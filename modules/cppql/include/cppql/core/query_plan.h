@@ -0,0 +1,117 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace sql
+{
+    /**
+     * \brief Single row of the output of EXPLAIN QUERY PLAN.
+     */
+    struct QueryPlanNode
+    {
+        int32_t id = 0;
+
+        /**
+         * \brief Id of the parent node. 0 for top-level nodes.
+         */
+        int32_t parent = 0;
+
+        /**
+         * \brief Description of the step, e.g. "SCAN t" or "SEARCH t USING INDEX i (a=?)".
+         */
+        std::string detail;
+
+        std::vector<QueryPlanNode> children;
+    };
+
+    /**
+     * \brief The QueryPlan class holds the tree that EXPLAIN QUERY PLAN reports for a statement. Note that the
+     * format of the detail strings is not guaranteed to be stable between sqlite versions.
+     */
+    class QueryPlan
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        QueryPlan() = default;
+
+        /**
+         * \brief Construct tree from the rows returned by EXPLAIN QUERY PLAN.
+         * \param rows List of nodes in the order sqlite returned them. Children are ignored.
+         */
+        explicit QueryPlan(const std::vector<QueryPlanNode>& rows);
+
+        QueryPlan(const QueryPlan&) = default;
+
+        QueryPlan(QueryPlan&&) noexcept = default;
+
+        ~QueryPlan() noexcept = default;
+
+        QueryPlan& operator=(const QueryPlan&) = default;
+
+        QueryPlan& operator=(QueryPlan&&) noexcept = default;
+
+        /**
+         * \brief Parse a plan that was formatted with toString.
+         * \param text Formatted plan.
+         * \return QueryPlan.
+         */
+        [[nodiscard]] static QueryPlan parse(std::string_view text);
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get the top-level nodes.
+         * \return List of nodes.
+         */
+        [[nodiscard]] const std::vector<QueryPlanNode>& getNodes() const noexcept;
+
+        /**
+         * \brief Check if the detail of any node contains the given text.
+         * \param text Text.
+         * \return True if found.
+         */
+        [[nodiscard]] bool contains(std::string_view text) const;
+
+        /**
+         * \brief Check if the table is read with a full scan instead of an index lookup. Scans of a covering index are
+         * also reported.
+         * \param table Table name.
+         * \return True if a SCAN node for the table exists.
+         */
+        [[nodiscard]] bool usesFullScan(std::string_view table) const;
+
+        /**
+         * \brief Format the plan the same way the sqlite command line shell does, one node per line.
+         * \return String.
+         */
+        [[nodiscard]] std::string toString() const;
+
+        ////////////////////////////////////////////////////////////////
+        // Compare.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Compare against an older plan of the same statement and list the ways in which this plan is worse.
+         * Reported are tables that were searched or not accessed before and are now fully scanned, and temporary
+         * b-trees (e.g. for ORDER BY or DISTINCT) and automatic indices that were added.
+         * \param baseline Older plan.
+         * \return List of human-readable descriptions. Empty if there are no regressions.
+         */
+        [[nodiscard]] std::vector<std::string> findRegressions(const QueryPlan& baseline) const;
+
+    private:
+        std::vector<QueryPlanNode> nodes;
+    };
+}  // namespace sql
@@ -0,0 +1,77 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <string>
+
+namespace sql
+{
+    class Database;
+
+    /**
+     * \brief The Savepoint class is a nestable transaction. Savepoints can be opened inside of a Transaction, inside
+     * of another Savepoint, or on their own, in which case they behave like a deferred transaction. This allows
+     * library code to group its writes without having to know whether the caller already opened a transaction. A
+     * Savepoint that is not released is rolled back on destruction. Savepoints must be destroyed in reverse order of
+     * creation.
+     */
+    class Savepoint
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        Savepoint() = delete;
+
+        Savepoint(const Savepoint&) = delete;
+
+        Savepoint(Savepoint&&) = delete;
+
+        explicit Savepoint(Database& db);
+
+        Savepoint& operator=(const Savepoint&) = delete;
+
+        Savepoint& operator=(Savepoint&&) = delete;
+
+        ~Savepoint() noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get nesting depth of this savepoint. The outermost savepoint has depth 0.
+         * \return Depth.
+         */
+        [[nodiscard]] size_t getDepth() const noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Commit.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Release the savepoint, merging its changes into the enclosing transaction. If there is no enclosing
+         * transaction, the changes are committed.
+         */
+        void release();
+
+        /**
+         * \brief Undo all changes made since the savepoint was opened, and release it.
+         */
+        void rollback();
+
+        ////////////////////////////////////////////////////////////////
+        // Member variables.
+        ////////////////////////////////////////////////////////////////
+    private:
+        Database* database;
+
+        size_t depth;
+
+        bool released = false;
+    };
+}  // namespace sql
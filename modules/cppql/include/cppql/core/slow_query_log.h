@@ -0,0 +1,165 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct sqlite3_stmt;
+
+namespace sql
+{
+    /**
+     * \brief Record of a single statement execution that exceeded the slow query threshold.
+     */
+    struct SlowQueryRecord
+    {
+        /**
+         * \brief Statement code, as returned by Statement::getSql.
+         */
+        std::string sql;
+
+        /**
+         * \brief Statement code with parameters replaced by their bound values.
+         */
+        std::string expandedSql;
+
+        /**
+         * \brief Wall time from the first step until the statement was reset or ran to completion.
+         */
+        std::chrono::nanoseconds duration{0};
+
+        /**
+         * \brief Number of result rows returned.
+         */
+        int64_t rows = 0;
+
+        /**
+         * \brief Time at which the record was made.
+         */
+        std::chrono::system_clock::time_point timestamp;
+    };
+
+    /**
+     * \brief Interface for receivers of slow query records. A sink can be shared between databases that are used
+     * from different threads, so implementations must be thread-safe.
+     */
+    class SlowQuerySink
+    {
+    public:
+        SlowQuerySink() = default;
+
+        SlowQuerySink(const SlowQuerySink&) = delete;
+
+        SlowQuerySink(SlowQuerySink&&) = delete;
+
+        virtual ~SlowQuerySink() noexcept = default;
+
+        SlowQuerySink& operator=(const SlowQuerySink&) = delete;
+
+        SlowQuerySink& operator=(SlowQuerySink&&) = delete;
+
+        virtual void write(const SlowQueryRecord& record) = 0;
+    };
+
+    using SlowQuerySinkPtr = std::shared_ptr<SlowQuerySink>;
+
+    /**
+     * \brief Sink that appends records to a file, one line per record, formatted as
+     * "<unix time in ms>\t<duration in us>\t<rows>\t<expanded sql>".
+     */
+    class FileSlowQuerySink final : public SlowQuerySink
+    {
+    public:
+        explicit FileSlowQuerySink(const std::filesystem::path& file);
+
+        void write(const SlowQueryRecord& record) override;
+
+    private:
+        std::mutex mutex;
+
+        std::ofstream stream;
+    };
+
+    /**
+     * \brief Sink that keeps the most recent records in memory.
+     */
+    class RingBufferSlowQuerySink final : public SlowQuerySink
+    {
+    public:
+        explicit RingBufferSlowQuerySink(size_t cap);
+
+        void write(const SlowQueryRecord& record) override;
+
+        /**
+         * \brief Get a copy of all records in the buffer, oldest first.
+         * \return Records.
+         */
+        [[nodiscard]] std::vector<SlowQueryRecord> getRecords() const;
+
+        void clear();
+
+    private:
+        size_t capacity;
+
+        mutable std::mutex mutex;
+
+        std::deque<SlowQueryRecord> records;
+    };
+
+    /**
+     * \brief The SlowQueryLog class receives the trace events of a database connection and writes a record to its
+     * sink for each statement execution that took at least as long as the threshold.
+     */
+    class SlowQueryLog
+    {
+    public:
+        SlowQueryLog() = delete;
+
+        SlowQueryLog(std::chrono::nanoseconds limit, SlowQuerySinkPtr s);
+
+        SlowQueryLog(const SlowQueryLog&) = delete;
+
+        SlowQueryLog(SlowQueryLog&&) = delete;
+
+        ~SlowQueryLog() noexcept = default;
+
+        SlowQueryLog& operator=(const SlowQueryLog&) = delete;
+
+        SlowQueryLog& operator=(SlowQueryLog&&) = delete;
+
+        [[nodiscard]] std::chrono::nanoseconds getThreshold() const noexcept;
+
+        [[nodiscard]] const SlowQuerySinkPtr& getSink() const noexcept;
+
+        /**
+         * \brief Callback that can be passed to sqlite3_trace_v2 with SQLITE_TRACE_PROFILE and SQLITE_TRACE_ROW, with
+         * a pointer to a SlowQueryLog as context.
+         */
+        static int32_t callback(uint32_t type, void* context, void* p, void* x) noexcept;
+
+    private:
+        void row(sqlite3_stmt* statement);
+
+        void profile(sqlite3_stmt* statement, std::chrono::nanoseconds duration);
+
+        std::chrono::nanoseconds threshold;
+
+        SlowQuerySinkPtr sink;
+
+        /**
+         * \brief Number of rows returned by each running statement.
+         */
+        std::unordered_map<sqlite3_stmt*, int64_t> rowCounts;
+    };
+}  // namespace sql
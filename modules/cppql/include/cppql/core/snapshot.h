@@ -0,0 +1,61 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+
+struct sqlite3_snapshot;
+
+namespace sql
+{
+    /**
+     * \brief The Snapshot class identifies a version of a database in WAL mode. It is captured by a read Transaction
+     * on one connection, and can be opened by read transactions on other connections to the same database file, so
+     * that they all see exactly the same data. A snapshot can only be opened as long as the WAL has not been reset
+     * since it was captured. Keeping the capturing transaction open until all other connections have opened the
+     * snapshot guarantees this. Requires CPPQL_ENABLE_SNAPSHOT.
+     */
+    class Snapshot
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        Snapshot() = delete;
+
+        /**
+         * \brief Take ownership of a snapshot returned by sqlite3_snapshot_get.
+         * \param handle Snapshot.
+         */
+        explicit Snapshot(sqlite3_snapshot* handle) noexcept;
+
+        Snapshot(const Snapshot&) = delete;
+
+        Snapshot(Snapshot&& other) noexcept;
+
+        ~Snapshot() noexcept;
+
+        Snapshot& operator=(const Snapshot&) = delete;
+
+        Snapshot& operator=(Snapshot&& other) noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        [[nodiscard]] sqlite3_snapshot* get() const noexcept;
+
+        /**
+         * \brief Compare the age of two snapshots of the same database file.
+         * \param other Other snapshot.
+         * \return Negative if this snapshot is older, 0 if they are the same, positive if this snapshot is newer.
+         */
+        [[nodiscard]] int32_t compare(const Snapshot& other) const;
+
+    private:
+        sqlite3_snapshot* snapshot = nullptr;
+    };
+}  // namespace sql
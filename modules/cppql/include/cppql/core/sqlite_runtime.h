@@ -0,0 +1,131 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <optional>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/memory_config.h"
+
+namespace sql
+{
+    /**
+     * \brief Threading mode of sqlite. Cannot be raised above the mode sqlite was compiled with.
+     */
+    enum class ThreadingMode
+    {
+        // No mutexes at all. Connections and statements must not be used from more than one thread.
+        SingleThread,
+        // Connections can be used from multiple threads, but each connection from one thread at a time.
+        MultiThread,
+        // Connections can be used from multiple threads at the same time.
+        Serialized
+    };
+
+    /**
+     * \brief Process wide settings of sqlite. Fields that are not set are left unchanged.
+     */
+    struct RuntimeConfig
+    {
+        std::optional<ThreadingMode> threadingMode;
+
+        /**
+         * \brief Default value of PRAGMA mmap_size for new connections.
+         */
+        std::optional<int64_t> mmapSize;
+
+        /**
+         * \brief Upper limit of PRAGMA mmap_size.
+         */
+        std::optional<int64_t> mmapLimit;
+
+        /**
+         * \brief Interpret file names passed to Database::open and friends as URIs.
+         */
+        std::optional<bool> uri;
+
+        std::optional<MemoryConfig> memory;
+    };
+
+    /**
+     * \brief The SqliteRuntime class is a reference to the process wide state of sqlite. The first reference
+     * configures and initializes sqlite, and the last reference shuts it down again. Every Database holds a reference,
+     * so keeping a SqliteRuntime alive for the lifetime of the process avoids repeatedly shutting down and
+     * reinitializing sqlite when databases are opened and closed.
+     */
+    class SqliteRuntime
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Acquire a reference. Initializes sqlite if there are no other references.
+         */
+        SqliteRuntime();
+
+        /**
+         * \brief Acquire the first reference. Configures and initializes sqlite. Throws if there are other references
+         * and the config is not empty, or if sqlite is still initialized (e.g. because the last reference was released
+         * without shutting down).
+         * \param config Settings.
+         */
+        explicit SqliteRuntime(const RuntimeConfig& config);
+
+        SqliteRuntime(const SqliteRuntime& other);
+
+        SqliteRuntime(SqliteRuntime&& other) noexcept;
+
+        ~SqliteRuntime() noexcept;
+
+        SqliteRuntime& operator=(const SqliteRuntime& other);
+
+        SqliteRuntime& operator=(SqliteRuntime&& other) noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get whether this object holds a reference. False after it was moved from.
+         * \return True if it holds a reference.
+         */
+        [[nodiscard]] bool holdsReference() const noexcept;
+
+        /**
+         * \brief Get whether sqlite is shut down if this is the last reference to be released.
+         * \return Shutdown.
+         */
+        [[nodiscard]] bool getShutdown() const noexcept;
+
+        /**
+         * \brief Get the number of references in the process.
+         * \return Number of references.
+         */
+        [[nodiscard]] static int64_t getUseCount();
+
+        ////////////////////////////////////////////////////////////////
+        // Setters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Set whether sqlite is shut down if this is the last reference to be released. Defaults to true.
+         * \param value Shutdown.
+         */
+        void setShutdown(bool value) noexcept;
+
+    private:
+        void release() noexcept;
+
+        bool acquired = false;
+
+        bool shutdown = true;
+    };
+}  // namespace sql
@@ -4,12 +4,17 @@
 // Standard includes.
 ////////////////////////////////////////////////////////////////
 
+#include <cstdint>
 #include <cstring>
 #include <concepts>
 #include <format>
 #include <memory>
+#include <source_location>
+#include <span>
 #include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 #include <vector>
 
 ////////////////////////////////////////////////////////////////
@@ -24,6 +29,7 @@
 
 #include "cppql/core/binding.h"
 #include "cppql/core/column.h"
+#include "cppql/core/statistics.h"
 #include "cppql/error/cppql_error.h"
 
 struct sqlite3_stmt;
@@ -77,13 +83,13 @@ namespace sql
 
         Statement(const Statement&) = delete;
 
-        Statement(Statement&&) noexcept = default;
+        Statement(Statement&& other) noexcept;
 
         ~Statement();
 
         Statement& operator=(const Statement&) = delete;
 
-        Statement& operator=(Statement&& other) noexcept = default;
+        Statement& operator=(Statement&& other) noexcept;
 
         ////////////////////////////////////////////////////////////////
         // Getters.
@@ -99,12 +105,33 @@ namespace sql
 
         [[nodiscard]] static int32_t getFirstBindIndex() noexcept;
 
+        /**
+         * \brief Get runtime counters of this statement. Internally calls sqlite3_stmt_status.
+         * \param reset If true, reset the counters to 0 after reading them.
+         * \return StatementStats. All zero if the statement is not prepared.
+         */
+        [[nodiscard]] StatementStats getStats(bool reset = false) const noexcept;
+
+        /**
+         * \brief Get runtime counters of each loop of this statement. Internally calls sqlite3_stmt_scanstatus_v2 (or
+         * sqlite3_stmt_scanstatus before sqlite 3.42.0). Requires CPPQL_ENABLE_SCANSTATUS, and sqlite compiled with
+         * SQLITE_ENABLE_STMT_SCANSTATUS.
+         * \return List of ScanStatus, in the same order as the EXPLAIN QUERY PLAN nodes.
+         */
+        [[nodiscard]] std::vector<ScanStatus> getScanStatus() const;
+
+        /**
+         * \brief Reset all counters returned by getScanStatus. Does nothing without CPPQL_ENABLE_SCANSTATUS.
+         */
+        void resetScanStatus() const noexcept;
+
         ////////////////////////////////////////////////////////////////
         // ...
         ////////////////////////////////////////////////////////////////
 
         /**
-         * \brief Prepare statement. Internally calls sqlite3_prepare_v2.
+         * \brief Prepare statement. If the database has a statement with the same code in its StatementCache, that
+         * statement is reused. Otherwise, internally calls sqlite3_prepare_v2.
          * \return Error code.
          */
         Result prepare() noexcept;
@@ -121,6 +148,23 @@ namespace sql
          */
         [[nodiscard]] Result reset() const noexcept;
 
+        /**
+         * \brief Throw the exception for a failed step. Interrupted statements throw an InterruptError, all others a
+         * SqliteError.
+         * \param msg Message.
+         * \param res Result of the failed step.
+         * \param loc Source location.
+         */
+        [[noreturn]] void throwError(const std::string&   msg,
+                                     const Result&        res,
+                                     std::source_location loc = std::source_location::current()) const;
+
+        /**
+         * \brief Reset the statement and throw an InterruptError if an active CancellationScope of the database
+         * requires it. Checked between the rows of a select statement, which sqlite does not interrupt on its own.
+         */
+        void checkCancellation() const;
+
         ////////////////////////////////////////////////////////////////
         // Bindings.
         ////////////////////////////////////////////////////////////////
@@ -399,6 +443,15 @@ namespace sql
          */
         void column(int32_t index, std::string& value) const;
 
+        /**
+         * \brief Retrieve a text column of the current result row without copying it. The view points into the row
+         * buffer of sqlite and is only valid until the next call to step or reset, or until the same column is retrieved
+         * as a different type. Internally calls sqlite3_column_text.
+         * \param index Column index.
+         * \param value Result value.
+         */
+        void column(int32_t index, std::string_view& value) const noexcept;
+
         /**
          * \brief Retrieve a blob column of the current result row as an object. If size of blob != sizeof(T), an exception is thrown. Internally calls sqlite3_column_blob.
          * \param index Column index.
@@ -424,7 +477,11 @@ namespace sql
         {
             // Get raw result data.
             const auto [data, size] = columnBlob(index);
-            if (size == 0) return;
+            if (size == 0)
+            {
+                values.clear();
+                return;
+            }
 
             // Copy to vector. If size of blob is not a multiple of sizeof(T), excess data is discarded.
             if (size % sizeof(T))
@@ -434,7 +491,40 @@ namespace sql
             std::memcpy(values.data(), data, size);
         }
 
+        /**
+         * \brief Retrieve a blob column of the current result row as a span without copying it. The span points into
+         * the row buffer of sqlite and is only valid until the next call to step or reset. If size of blob is not a
+         * multiple of sizeof(T) or the data is not suitably aligned for T, an exception is thrown. Internally calls
+         * sqlite3_column_blob.
+         * \param index Column index.
+         * \param values Span that is pointed at the data.
+         */
+        template<typename T>
+            requires(std::is_trivially_copyable_v<T>)
+        void column(const int32_t index, std::span<const T>& values) const
+        {
+            // Get raw result data.
+            const auto [data, size] = columnBlob(index);
+            if (size == 0)
+            {
+                values = {};
+                return;
+            }
+
+            if (size % sizeof(T))
+                throw CppqlError(
+                  std::format("Size of data ({}) is not a multiple of size of object ({})", size, sizeof(T)));
+            if (reinterpret_cast<std::uintptr_t>(data) % alignof(T))
+                throw CppqlError(std::format("Data is not aligned to alignment of object ({})", alignof(T)));
+            values = std::span(static_cast<const T*>(data), size / sizeof(T));
+        }
+
     private:
+        /**
+         * \brief Finalize statement or return it to the StatementCache of the database.
+         */
+        void release() noexcept;
+
         /**
          * \brief Retrieve a blob column of the current result row. Data is still owned by sqlite.
          * \param index Column index.
@@ -0,0 +1,131 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+struct sqlite3_stmt;
+
+namespace sql
+{
+    /**
+     * \brief The StatementCache class is a bounded LRU cache of prepared sqlite statements, keyed by their SQL code.
+     * Statements that are released into the cache are reset and have their bindings cleared, so that they can be
+     * handed out again as if freshly prepared. The least recently released statement is finalized when the cache
+     * runs out of space.
+     */
+    class StatementCache
+    {
+    public:
+        ////////////////////////////////////////////////////////////////
+        // Constructors.
+        ////////////////////////////////////////////////////////////////
+
+        StatementCache() = default;
+
+        explicit StatementCache(size_t cap);
+
+        StatementCache(const StatementCache&) = delete;
+
+        StatementCache(StatementCache&& other) noexcept;
+
+        ~StatementCache() noexcept;
+
+        StatementCache& operator=(const StatementCache&) = delete;
+
+        StatementCache& operator=(StatementCache&& other) noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get maximum number of statements held by this cache. A capacity of 0 disables the cache.
+         * \return Capacity.
+         */
+        [[nodiscard]] size_t getCapacity() const noexcept;
+
+        /**
+         * \brief Get number of statements currently held by this cache.
+         * \return Size.
+         */
+        [[nodiscard]] size_t getSize() const noexcept;
+
+        /**
+         * \brief Get number of times a statement could be taken from this cache.
+         * \return Number of hits.
+         */
+        [[nodiscard]] size_t getHits() const noexcept;
+
+        /**
+         * \brief Get number of times a statement was requested that was not in this cache.
+         * \return Number of misses.
+         */
+        [[nodiscard]] size_t getMisses() const noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // Setters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Set maximum number of statements held by this cache. Finalizes statements that no longer fit.
+         * \param value Capacity.
+         */
+        void setCapacity(size_t value) noexcept;
+
+        ////////////////////////////////////////////////////////////////
+        // ...
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Take a statement out of the cache. Ownership is transferred to the caller.
+         * \param sql SQL code.
+         * \return Statement, or nullptr if there is no statement with the given code in the cache.
+         */
+        [[nodiscard]] sqlite3_stmt* acquire(const std::string& sql) noexcept;
+
+        /**
+         * \brief Return a statement to the cache. Ownership is transferred to the cache. The statement is reset and
+         * its bindings are cleared. If the cache is disabled or already holds a statement with the same code, the
+         * statement is finalized instead.
+         * \param sql SQL code.
+         * \param statement Statement.
+         */
+        void release(const std::string& sql, sqlite3_stmt* statement) noexcept;
+
+        /**
+         * \brief Finalize all statements in the cache.
+         */
+        void clear() noexcept;
+
+    private:
+        void evict(size_t count) noexcept;
+
+        using entry_t = std::pair<std::string, sqlite3_stmt*>;
+
+        /**
+         * \brief Maximum number of statements.
+         */
+        size_t capacity = 0;
+
+        /**
+         * \brief Cached statements. Most recently released statement is at the front.
+         */
+        std::list<entry_t> entries;
+
+        /**
+         * \brief Lookup of cached statements by code. Keys point into the strings stored in entries.
+         */
+        std::unordered_map<std::string_view, std::list<entry_t>::iterator> lookup;
+
+        size_t hits = 0;
+
+        size_t misses = 0;
+    };
+}  // namespace sql
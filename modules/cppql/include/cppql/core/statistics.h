@@ -0,0 +1,166 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdint>
+#include <string>
+
+namespace sql
+{
+    /**
+     * \brief Runtime counters of a prepared statement, as reported by sqlite3_stmt_status.
+     */
+    struct StatementStats
+    {
+        /**
+         * \brief Number of times a table was stepped through in a full scan. A large value may indicate a missing
+         * index.
+         */
+        int64_t fullscanSteps = 0;
+
+        /**
+         * \brief Number of sort operations.
+         */
+        int64_t sorts = 0;
+
+        /**
+         * \brief Number of rows inserted into automatic indices. A nonzero value may indicate a missing index.
+         */
+        int64_t autoIndexes = 0;
+
+        /**
+         * \brief Number of virtual machine operations.
+         */
+        int64_t vmSteps = 0;
+
+        /**
+         * \brief Number of times the statement was automatically reprepared because of schema changes.
+         */
+        int64_t reprepares = 0;
+
+        /**
+         * \brief Number of times the statement was run to completion or reset.
+         */
+        int64_t runs = 0;
+
+        /**
+         * \brief Bytes of heap memory used by the statement.
+         */
+        int64_t memoryUsed = 0;
+    };
+
+    /**
+     * \brief Runtime counters of a single loop of a prepared statement, as reported by sqlite3_stmt_scanstatus.
+     */
+    struct ScanStatus
+    {
+        /**
+         * \brief Name of the table or index that is looped over.
+         */
+        std::string name;
+
+        /**
+         * \brief Detail of the matching EXPLAIN QUERY PLAN node.
+         */
+        std::string explain;
+
+        /**
+         * \brief Id of the matching EXPLAIN QUERY PLAN node.
+         */
+        int32_t selectId = 0;
+
+        /**
+         * \brief Id of the parent EXPLAIN QUERY PLAN node. Only available with sqlite 3.42.0 or newer.
+         */
+        int32_t parentId = 0;
+
+        /**
+         * \brief Number of times the loop was run.
+         */
+        int64_t loops = 0;
+
+        /**
+         * \brief Number of rows visited over all runs of the loop.
+         */
+        int64_t rowsVisited = 0;
+
+        /**
+         * \brief Number of rows the query planner estimated per run of the loop. Compare with rowsVisited / loops.
+         */
+        double estimatedRows = 0;
+
+        /**
+         * \brief Number of CPU cycles spent in the loop. Only available with sqlite 3.42.0 or newer, and only if sqlite
+         * was compiled with SQLITE_ENABLE_STMT_SCANSTATUS. -1 otherwise.
+         */
+        int64_t cycles = -1;
+    };
+
+    /**
+     * \brief Runtime counters of a database connection, as reported by sqlite3_db_status.
+     */
+    struct DatabaseStats
+    {
+        /**
+         * \brief Number of page cache hits.
+         */
+        int64_t cacheHits = 0;
+
+        /**
+         * \brief Number of page cache misses.
+         */
+        int64_t cacheMisses = 0;
+
+        /**
+         * \brief Number of dirty pages written to disk.
+         */
+        int64_t cacheWrites = 0;
+
+        /**
+         * \brief Number of dirty pages written to disk in the middle of a transaction, because the cache was full.
+         */
+        int64_t cacheSpills = 0;
+
+        /**
+         * \brief Bytes of heap memory used by the page cache.
+         */
+        int64_t cacheUsed = 0;
+
+        /**
+         * \brief Number of lookaside memory slots currently in use.
+         */
+        int64_t lookasideUsed = 0;
+
+        /**
+         * \brief Maximum number of lookaside memory slots that were in use at the same time.
+         */
+        int64_t lookasideHighwater = 0;
+
+        /**
+         * \brief Number of allocations served from lookaside memory.
+         */
+        int64_t lookasideHits = 0;
+
+        /**
+         * \brief Number of allocations that were too large for lookaside memory.
+         */
+        int64_t lookasideMissSize = 0;
+
+        /**
+         * \brief Number of allocations that did not fit because all lookaside memory was in use.
+         */
+        int64_t lookasideMissFull = 0;
+
+        /**
+         * \brief Bytes of heap memory used to store the schema.
+         */
+        int64_t schemaUsed = 0;
+
+        /**
+         * \brief Bytes of heap memory used by all prepared statements.
+         */
+        int64_t statementUsed = 0;
+    };
+}  // namespace sql
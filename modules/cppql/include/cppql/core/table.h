@@ -31,6 +31,14 @@ namespace sql
 
         Table(Database* database, std::string tableName);
 
+        /**
+         * \brief Construct table in an attached database.
+         * \param database Database.
+         * \param schemaName Alias of the attached database. Empty for the main database.
+         * \param tableName Table name.
+         */
+        Table(Database* database, std::string schemaName, std::string tableName);
+
         /**
          * \brief Run the CREATE TABLE statement to commit this table to the database.
          */
@@ -50,6 +58,26 @@ namespace sql
 
         [[nodiscard]] const std::string& getName() const noexcept;
 
+        /**
+         * \brief Get the alias of the attached database this table is in.
+         * \return Schema name. Empty for the main database.
+         */
+        [[nodiscard]] const std::string& getSchema() const noexcept;
+
+        /**
+         * \brief Get the name with which this table is referred to in generated SQL.
+         * \return Table name, prefixed with "schema." for tables in attached databases.
+         */
+        [[nodiscard]] std::string getQualifiedName() const;
+
+        /**
+         * \brief Qualify a table name with a schema name.
+         * \param schemaName Schema name. Empty for the main database.
+         * \param tableName Table name.
+         * \return "schema.table", or "table" if the schema name is empty.
+         */
+        [[nodiscard]] static std::string qualify(const std::string& schemaName, const std::string& tableName);
+
         [[nodiscard]] bool getWithoutRowid() const noexcept;
 
         [[nodiscard]] bool getStrict() const noexcept;
@@ -94,6 +122,15 @@ namespace sql
         void readFromDb(
           std::unordered_map<std::string, std::vector<std::tuple<std::string, std::string, std::string>>>& foreignKeys);
 
+        /**
+         * \brief Create a column from its definition as stored in the database schema.
+         * \param columnName Column name.
+         * \param declaredType Declared type.
+         * \param notNull Has NOT NULL constraint.
+         * \param primaryKey Is (part of) the primary key.
+         */
+        void readColumn(const std::string& columnName, const std::string& declaredType, bool notNull, bool primaryKey);
+
         void resolveForeignKeys(
           const std::unordered_map<std::string, std::vector<std::tuple<std::string, std::string, std::string>>>&
                                                      foreignKeys,
@@ -104,6 +141,11 @@ namespace sql
          */
         Database* db;
 
+        /**
+         * \brief Alias of the attached database this table is in. Empty for the main database.
+         */
+        std::string schema;
+
         /**
          * \brief Table name.
          */
@@ -1,5 +1,17 @@
 #pragma once
 
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/snapshot.h"
+
 namespace sql
 {
     class Database;
@@ -28,7 +40,24 @@ namespace sql
 
         Transaction(Transaction&&) = delete;
 
-        Transaction(Database& db, Type type);
+        /**
+         * \brief Begin a transaction.
+         * \param db Database.
+         * \param type Transaction type.
+         * \param retries Number of times to retry beginning the transaction if the database is busy. Waits between
+         * retries according to the busy policy of the database, or the default BusyPolicy if there is none. No retry
+         * starts once BusyPolicy::maxWait has passed since the first attempt. Because the busy handler of the database
+         * may itself wait up to maxWait inside of the last attempt, the total wait is bounded by twice maxWait.
+         */
+        Transaction(Database& db, Type type, size_t retries = 0);
+
+        /**
+         * \brief Begin a deferred transaction that reads from a snapshot captured on another connection to the same
+         * database. Requires CPPQL_ENABLE_SNAPSHOT.
+         * \param db Database.
+         * \param snapshot Snapshot.
+         */
+        Transaction(Database& db, const Snapshot& snapshot);
 
         Transaction& operator=(const Transaction&) = delete;
 
@@ -44,6 +73,17 @@ namespace sql
 
         void rollback();
 
+        ////////////////////////////////////////////////////////////////
+        // Snapshot.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Capture the version of the database this transaction reads from. Starts reading if nothing was read
+         * yet. Fails if the transaction has written to the database. Requires CPPQL_ENABLE_SNAPSHOT.
+         * \return Snapshot.
+         */
+        [[nodiscard]] Snapshot getSnapshot() const;
+
         ////////////////////////////////////////////////////////////////
         // Member variables.
         ////////////////////////////////////////////////////////////////
@@ -0,0 +1,49 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <string>
+#include <source_location>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/sqlite_error.h"
+
+namespace sql
+{
+    /**
+     * \brief Why a statement was interrupted.
+     */
+    enum class InterruptReason
+    {
+        // Database::interrupt was called.
+        Interrupt,
+        // The CancellationToken of an active CancellationScope was cancelled.
+        Cancelled,
+        // The deadline of an active CancellationScope has passed.
+        Deadline,
+        // The callback installed with Database::setProgressHandler returned true.
+        ProgressHandler
+    };
+
+    /**
+     * \brief Thrown when a statement fails with SQLITE_INTERRUPT, or when a select statement is stopped between rows
+     * by a CancellationScope.
+     */
+    class InterruptError final : public SqliteError
+    {
+    public:
+        InterruptError(const std::string&   msg,
+                       InterruptReason      interruptReason,
+                       std::source_location loc = std::source_location::current());
+
+        [[nodiscard]] InterruptReason getReason() const noexcept;
+
+    private:
+        InterruptReason reason;
+    };
+}  // namespace sql
@@ -10,7 +10,7 @@
 
 namespace sql
 {
-    class SqliteError final : public std::exception
+    class SqliteError : public std::exception
     {
     public:
         SqliteError(const std::string&   msg,
@@ -73,7 +73,7 @@ namespace sql
          */
         [[nodiscard]] std::string fullName() const
         {
-            return std::format("{}.{}", table->getName(), table->getColumn(Index).getName());
+            return std::format("{}.{}", table->getQualifiedName(), table->getColumn(Index).getName());
         }
 
         [[nodiscard]] std::string toString() const
@@ -20,14 +20,31 @@
 #include "cppql/clauses/union.h"
 #include "cppql/clauses/using.h"
 #include "cppql/clauses/where.h"
+#include "cppql/core/async_database.h"
+#include "cppql/core/backup.h"
 #include "cppql/core/binding.h"
+#include "cppql/core/busy_handler.h"
+#include "cppql/core/cancellation.h"
+#include "cppql/core/checkpointer.h"
 #include "cppql/core/column.h"
 #include "cppql/core/database.h"
+#include "cppql/core/database_options.h"
+#include "cppql/core/database_pool.h"
 #include "cppql/core/enums.h"
+#include "cppql/core/memory_config.h"
+#include "cppql/core/progress_handler.h"
+#include "cppql/core/query_plan.h"
+#include "cppql/core/savepoint.h"
+#include "cppql/core/slow_query_log.h"
+#include "cppql/core/snapshot.h"
+#include "cppql/core/sqlite_runtime.h"
 #include "cppql/core/statement.h"
+#include "cppql/core/statement_cache.h"
+#include "cppql/core/statistics.h"
 #include "cppql/core/table.h"
 #include "cppql/core/transaction.h"
 #include "cppql/error/cppql_error.h"
+#include "cppql/error/interrupt_error.h"
 #include "cppql/error/sqlite_error.h"
 #include "cppql/expressions/aggregate_expression.h"
 #include "cppql/expressions/column_comparison_expression.h"
@@ -48,6 +65,7 @@
 #include "cppql/statements/select_statement.h"
 #include "cppql/statements/select_one_statement.h"
 #include "cppql/statements/update_statement.h"
+#include "cppql/typed/aggregate_members.h"
 #include "cppql/typed/fwd.h"
 #include "cppql/typed/join.h"
 #include "cppql/typed/join_type.h"
@@ -12,6 +12,7 @@
 ////////////////////////////////////////////////////////////////
 
 #include "cppql/clauses/where.h"
+#include "cppql/core/query_plan.h"
 #include "cppql/error/cppql_error.h"
 #include "cppql/expressions/filter_expression.h"
 #include "cppql/statements/count_statement.h"
@@ -90,7 +91,7 @@ namespace sql
         [[nodiscard]] std::string toString()
         {
             // SELECT COUNT(*) FROM <table> WHERE <expr>;
-            auto sql = std::format("SELECT COUNT(*) FROM {0} {1};", table->getName(), filter.toString());
+            auto sql = std::format("SELECT COUNT(*) FROM {0} {1};", table->getQualifiedName(), filter.toString());
 
             return sql;
         }
@@ -101,6 +102,16 @@ namespace sql
             filter.generateIndices(index);
         }
 
+        /**
+         * \brief Get the query plan sqlite chooses for the generated SQL code, without running it.
+         * \return QueryPlan.
+         */
+        [[nodiscard]] QueryPlan explain()
+        {
+            generateIndices();
+            return table->getDatabase().explain(toString());
+        }
+
         /**
          * \brief Generate CountStatement object. Generates and compiles SQL code.
          * \tparam Self Self type.
@@ -109,11 +120,25 @@ namespace sql
          */
         template<typename Self>
         [[nodiscard]] auto compile(this Self&& self)
+        {
+            auto& db = self.table->getDatabase();
+            return std::forward<Self>(self).compile(db);
+        }
+
+        /**
+         * \brief Generate CountStatement object. Generates and compiles SQL code against another connection to the same database (e.g. a reader leased from a DatabasePool).
+         * \tparam Self Self type.
+         * \param self Self.
+         * \param db Database connection to prepare the statement on.
+         * \return CountStatement.
+         */
+        template<typename Self>
+        [[nodiscard]] auto compile(this Self&& self, Database& db)
         {
             self.generateIndices();
 
             // Construct statement from generated SQL.
-            auto stmt = std::make_unique<Statement>(self.table->getDatabase(), self.toString(), true);
+            auto stmt = std::make_unique<Statement>(db, self.toString(), true);
             if (!stmt->isPrepared())
                 throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt->getSql()),
                                   stmt->getResult()->code,
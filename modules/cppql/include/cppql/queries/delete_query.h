@@ -14,6 +14,7 @@
 #include "cppql/clauses/limit.h"
 #include "cppql/clauses/order_by.h"
 #include "cppql/clauses/where.h"
+#include "cppql/core/query_plan.h"
 #include "cppql/error/cppql_error.h"
 #include "cppql/expressions/filter_expression.h"
 #include "cppql/statements/delete_statement.h"
@@ -145,8 +146,11 @@ namespace sql
         [[nodiscard]] std::string toString()
         {
             // DELETE FROM <table> WHERE <expr> ORDER BY <expr> LIMIT <val> OFFSET <val>;
-            auto sql = std::format(
-              "DELETE FROM {0} {1} {2} {3};", table->getName(), filter.toString(), order.toString(), limit.toString());
+            auto sql = std::format("DELETE FROM {0} {1} {2} {3};",
+                                   table->getQualifiedName(),
+                                   filter.toString(),
+                                   order.toString(),
+                                   limit.toString());
 
             return sql;
         }
@@ -157,6 +161,16 @@ namespace sql
             filter.generateIndices(index);
         }
 
+        /**
+         * \brief Get the query plan sqlite chooses for the generated SQL code, without running it.
+         * \return QueryPlan.
+         */
+        [[nodiscard]] QueryPlan explain()
+        {
+            generateIndices();
+            return table->getDatabase().explain(toString());
+        }
+
         /**
          * \brief Generate DeleteStatement object. Generates and compiles SQL code and binds requested parameters.
          * \tparam Self Self type.
@@ -165,11 +179,25 @@ namespace sql
          */
         template<typename Self>
         [[nodiscard]] auto compile(this Self&& self)
+        {
+            auto& db = self.table->getDatabase();
+            return std::forward<Self>(self).compile(db);
+        }
+
+        /**
+         * \brief Generate DeleteStatement object. Generates and compiles SQL code against another connection to the same database (e.g. a reader leased from a DatabasePool) and binds requested parameters.
+         * \tparam Self Self type.
+         * \param self Self.
+         * \param db Database connection to prepare the statement on.
+         * \return DeleteStatement.
+         */
+        template<typename Self>
+        [[nodiscard]] auto compile(this Self&& self, Database& db)
         {
             self.generateIndices();
 
             // Construct statement from generated SQL.
-            auto stmt = std::make_unique<Statement>(self.table->getDatabase(), self.toString(), true);
+            auto stmt = std::make_unique<Statement>(db, self.toString(), true);
             if (!stmt->isPrepared())
                 throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt->getSql()),
                                   stmt->getResult()->code,
@@ -65,14 +65,16 @@ namespace sql
         {
             if constexpr (columns_t::size == 0)
             {
-                return std::format("INSERT INTO {0} DEFAULT VALUES;", table->getName());
+                return std::format("INSERT INTO {0} DEFAULT VALUES;", table->getQualifiedName());
             }
             else
             {
                 std::string vals = "?1";
                 for (size_t i = 1; i < columns_t::size; i++) vals += std::format(",?{0}", i + 1);
-                return std::format(
-                  "INSERT INTO {0} ({1}) VALUES ({2});", table->getName(), columns.toString(), std::move(vals));
+                return std::format("INSERT INTO {0} ({1}) VALUES ({2});",
+                                   table->getQualifiedName(),
+                                   columns.toString(),
+                                   std::move(vals));
             }
         }
 
@@ -84,10 +86,24 @@ namespace sql
          */
         template<typename Self>
         [[nodiscard]] auto compile(this Self&& self)
+        {
+            auto& db = self.table->getDatabase();
+            return std::forward<Self>(self).compile(db);
+        }
+
+        /**
+         * \brief Generate InsertStatement object. Generates and compiles SQL code against another connection to the same database (e.g. a reader leased from a DatabasePool).
+         * \tparam Self Self type.
+         * \param self Self.
+         * \param db Database connection to prepare the statement on.
+         * \return InsertStatement.
+         */
+        template<typename Self>
+        [[nodiscard]] auto compile(this Self&& self, Database& db)
         {
             // Construct statement. Note: This generates the bind indices of all filter expressions
             // and should therefore happen before the BaseFilterExpressionPtr construction below.
-            auto stmt = std::make_unique<Statement>(self.table->getDatabase(), self.toString(), true);
+            auto stmt = std::make_unique<Statement>(db, self.toString(), true);
             if (!stmt->isPrepared())
                 throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt->getSql()),
                                   stmt->getResult()->code,
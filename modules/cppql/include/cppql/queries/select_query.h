@@ -18,6 +18,7 @@
 #include "cppql/clauses/order_by.h"
 #include "cppql/clauses/union.h"
 #include "cppql/clauses/where.h"
+#include "cppql/core/query_plan.h"
 #include "cppql/expressions/column_expression.h"
 #include "cppql/expressions/filter_expression.h"
 #include "cppql/statements/select_statement.h"
@@ -366,6 +367,17 @@ namespace sql
             unionClause.generateIndices(idx);
         }
 
+        /**
+         * \brief Get the query plan sqlite chooses for the generated SQL code, without running it.
+         * \return QueryPlan.
+         */
+        [[nodiscard]] QueryPlan explain()
+        {
+            int32_t idx = 0;
+            generateIndices(idx);
+            return join.getTable().getDatabase().explain(std::format("{0};", toString()));
+        }
+
         [[nodiscard]] auto getFilters()
         {
             if constexpr (is_table)
@@ -387,16 +399,30 @@ namespace sql
          */
         template<typename Self>
         [[nodiscard]] auto compile(this Self&& self)
+        {
+            auto& db = self.join.getTable().getDatabase();
+            return std::forward<Self>(self).compile(db);
+        }
+
+        /**
+         * \brief Generate SelectStatement object. Generates and compiles SQL code against another connection to
+         * the same database (e.g. a reader leased from a DatabasePool) and binds requested parameters.
+         * \tparam Self Self type.
+         * \param self Self.
+         * \param db Database connection to prepare the statement on.
+         * \return SelectStatement.
+         */
+        template<typename Self>
+        [[nodiscard]] auto compile(this Self&& self, Database& db)
         {
             int32_t idx = 0;
             self.generateIndices(idx);
 
-            auto select = []<std::size_t... Is>(auto&& self, std::index_sequence<Is...>)
+            auto select = [&db]<std::size_t... Is>(auto&& self, std::index_sequence<Is...>)
             {
                 // Construct statement. Note: This generates the bind indices of all filter expressions
                 // and should therefore happen before the BaseFilterExpressionPtr construction below.
-                auto stmt = std::make_unique<Statement>(
-                  self.join.getTable().getDatabase(), std::format("{0};", self.toString()), true);
+                auto stmt = std::make_unique<Statement>(db, std::format("{0};", self.toString()), true);
                 if (!stmt->isPrepared())
                     throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt->getSql()),
                                       stmt->getResult()->code,
@@ -435,5 +461,19 @@ namespace sql
         {
             return SelectOneStatement(std::forward<Self>(self).compile());
         }
+
+        /**
+         * \brief Generate SelectOneStatement object. Generates and compiles SQL code against another connection to
+         * the same database and binds requested parameters.
+         * \tparam Self Self type.
+         * \param self Self.
+         * \param db Database connection to prepare the statement on.
+         * \return SelectOneStatement.
+         */
+        template<typename Self>
+        [[nodiscard]] auto compileOne(this Self&& self, Database& db)
+        {
+            return SelectOneStatement(std::forward<Self>(self).compile(db));
+        }
     };
 }  // namespace sql
@@ -15,6 +15,7 @@
 #include "cppql/clauses/limit.h"
 #include "cppql/clauses/order_by.h"
 #include "cppql/clauses/where.h"
+#include "cppql/core/query_plan.h"
 #include "cppql/expressions/column_expression.h"
 #include "cppql/expressions/filter_expression.h"
 #include "cppql/statements/update_statement.h"
@@ -164,7 +165,7 @@ namespace sql
 
             // UPDATE <table> SET (<cols>) = (<vals>) WHERE <expr> ORDER BY <expr> LIMIT <val> OFFSET <val>;
             auto sql = std::format("UPDATE {0} SET ({1}) = ({2}) {3} {4} {5};",
-                                   table->getName(),
+                                   table->getQualifiedName(),
                                    columns.toString(),
                                    std::move(vals),
                                    filter.toString(),
@@ -180,6 +181,16 @@ namespace sql
             filter.generateIndices(index);
         }
 
+        /**
+         * \brief Get the query plan sqlite chooses for the generated SQL code, without running it.
+         * \return QueryPlan.
+         */
+        [[nodiscard]] QueryPlan explain()
+        {
+            generateIndices();
+            return table->getDatabase().explain(toString());
+        }
+
         /**
          * \brief Generate UpdateStatement object. Generates and compiles SQL code and binds requested parameters.
          * \tparam Self Self type.
@@ -188,12 +199,26 @@ namespace sql
          */
         template<typename Self>
         [[nodiscard]] auto compile(this Self&& self)
+        {
+            auto& db = self.table->getDatabase();
+            return std::forward<Self>(self).compile(db);
+        }
+
+        /**
+         * \brief Generate UpdateStatement object. Generates and compiles SQL code against another connection to the same database (e.g. a reader leased from a DatabasePool) and binds requested parameters.
+         * \tparam Self Self type.
+         * \param self Self.
+         * \param db Database connection to prepare the statement on.
+         * \return UpdateStatement.
+         */
+        template<typename Self>
+        [[nodiscard]] auto compile(this Self&& self, Database& db)
         {
             self.generateIndices();
 
             // Construct statement. Note: This generates the bind indices of all filter expressions
             // and should therefore happen before the BaseFilterExpressionPtr construction below.
-            auto stmt = std::make_unique<Statement>(self.table->getDatabase(), self.toString(), true);
+            auto stmt = std::make_unique<Statement>(db, self.toString(), true);
             if (!stmt->isPrepared())
                 throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt->getSql()),
                                   stmt->getResult()->code,
@@ -40,6 +40,28 @@ namespace sql
 
         DeleteStatement& operator=(DeleteStatement&& other) noexcept = default;
 
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get runtime counters of the underlying statement.
+         * \param reset If true, reset the counters to 0 after reading them.
+         * \return StatementStats.
+         */
+        [[nodiscard]] StatementStats getStats(const bool reset = false) const noexcept { return stmt->getStats(reset); }
+
+        /**
+         * \brief Get runtime counters of each loop of the underlying statement. Requires CPPQL_ENABLE_SCANSTATUS.
+         * \return List of ScanStatus.
+         */
+        [[nodiscard]] std::vector<ScanStatus> getScanStatus() const { return stmt->getScanStatus(); }
+
+        /**
+         * \brief Reset the counters returned by getScanStatus.
+         */
+        void resetScanStatus() const noexcept { stmt->resetScanStatus(); }
+
         ////////////////////////////////////////////////////////////////
         // Run.
         ////////////////////////////////////////////////////////////////
@@ -66,7 +88,7 @@ namespace sql
             if (const auto res = stmt->step(); !res)
             {
                 static_cast<void>(stmt->reset());
-                throw SqliteError(std::format("Failed to step through delete statement."), res.code, res.extendedCode);
+                stmt->throwError(std::format("Failed to step through delete statement."), res);
             }
 
             // Reset statement.
@@ -13,7 +13,8 @@ namespace sql
 {
     /**
      * \brief The SelectOneStatement class wraps around a Select instance. It uses the instance to return just one
-     * result row.
+     * result row. Because the statement is reset before the row is returned, R must not hold std::string_view or
+     * std::span members.
      * \tparam R Return type.
      * \tparam Cs Types of the columns to retrieve.
      */
@@ -51,6 +52,28 @@ namespace sql
 
         SelectOneStatement& operator=(SelectOneStatement&& other) noexcept = default;
 
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get runtime counters of the underlying statement.
+         * \param reset If true, reset the counters to 0 after reading them.
+         * \return StatementStats.
+         */
+        [[nodiscard]] StatementStats getStats(const bool reset = false) const noexcept { return stmt.getStats(reset); }
+
+        /**
+         * \brief Get runtime counters of each loop of the underlying statement. Requires CPPQL_ENABLE_SCANSTATUS.
+         * \return List of ScanStatus.
+         */
+        [[nodiscard]] std::vector<ScanStatus> getScanStatus() const { return stmt.getScanStatus(); }
+
+        /**
+         * \brief Reset the counters returned by getScanStatus.
+         */
+        void resetScanStatus() const noexcept { stmt.resetScanStatus(); }
+
         ////////////////////////////////////////////////////////////////
         // Run.
         ////////////////////////////////////////////////////////////////
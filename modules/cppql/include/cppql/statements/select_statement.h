@@ -4,8 +4,13 @@
 // Standard includes.
 ////////////////////////////////////////////////////////////////
 
+#include <concepts>
+#include <functional>
 #include <iterator>
 #include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 ////////////////////////////////////////////////////////////////
 // Current target includes.
@@ -13,7 +18,9 @@
 
 #include "cppql/core/enums.h"
 #include "cppql/core/statement.h"
+#include "cppql/error/cppql_error.h"
 #include "cppql/error/sqlite_error.h"
+#include "cppql/typed/aggregate_members.h"
 #include "cppql/typed/fwd.h"
 #include "cppql/typed/typed_table.h"
 
@@ -21,7 +28,9 @@ namespace sql
 {
     /**
      * \brief The SelectStatement class manages a prepared statement to retrieve rows from a table (or unions and joins
-     * of tables). It can be constructed using a SelectQuery.
+     * of tables). It can be constructed using a SelectQuery. Text and blob columns can be returned without copying by
+     * giving R std::string_view or std::span<const T> members. These point into the row buffer of sqlite and are only
+     * valid until the iterator is advanced.
      * \tparam R Return type.
      * \tparam Cs Types of the columns to retrieve.
      */
@@ -57,24 +66,7 @@ namespace sql
 
             iterator& operator++()
             {
-                auto res = stmt->step();
-                code     = res.code;
-
-                if (code != Result::sqlite_row && code != Result::sqlite_done)
-                {
-                    static_cast<void>(stmt->reset());
-                    throw SqliteError(
-                      std::format("Failed to step through select statement."), res.code, res.extendedCode);
-                }
-
-                // Reached last row. Reset statement for next invocation.
-                if (code == Result::sqlite_done)
-                {
-                    res = stmt->reset();
-                    if (!res)
-                        throw SqliteError(std::format("Failed to reset select statement."), res.code, res.extendedCode);
-                }
-
+                code = SelectStatement::step(*stmt);
                 return *this;
             }
 
@@ -89,20 +81,15 @@ namespace sql
 
             bool operator!=(iterator other) const { return !(*this == other); }
 
-            reference operator*() const
-            {
-                using return_tuple_t = std::tuple<get_column_return_t<Cs>...>;
+            reference operator*() const { return SelectStatement::makeRow(*stmt); }
 
-                auto f = [this]<std::size_t... Is>(std::index_sequence<Is...>)
-                {
-                    // std::tuple_element_t<Is...> gets the return type of each selected column.
-                    // stmt->column(Is...) gets each column value.
-                    return return_t(std::move(stmt->column<std::tuple_element_t<Is, return_tuple_t>>(Is))...);
-                };
+        private:
+            friend class SelectStatement;
 
-                // Call f with 0, 1, sizeof...(Indices) - 1.
-                return f(std::index_sequence_for<Cs...>());
-            }
+            /**
+             * \brief Construct an iterator at the row the statement is currently positioned on, without stepping.
+             */
+            iterator(Statement& statement, const int32_t c) : stmt(&statement), code(c) {}
         };
 
         ////////////////////////////////////////////////////////////////
@@ -126,14 +113,109 @@ namespace sql
 
         SelectStatement& operator=(SelectStatement&& other) noexcept = default;
 
+        ////////////////////////////////////////////////////////////////
+        // Getters.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Get runtime counters of the underlying statement.
+         * \param reset If true, reset the counters to 0 after reading them.
+         * \return StatementStats.
+         */
+        [[nodiscard]] StatementStats getStats(const bool reset = false) const noexcept { return stmt->getStats(reset); }
+
+        /**
+         * \brief Get runtime counters of each loop of the underlying statement. Requires CPPQL_ENABLE_SCANSTATUS.
+         * \return List of ScanStatus.
+         */
+        [[nodiscard]] std::vector<ScanStatus> getScanStatus() const { return stmt->getScanStatus(); }
+
+        /**
+         * \brief Reset the counters returned by getScanStatus.
+         */
+        void resetScanStatus() const noexcept { stmt->resetScanStatus(); }
+
         ////////////////////////////////////////////////////////////////
         // Run.
         ////////////////////////////////////////////////////////////////
 
-        iterator begin() { return iterator(*stmt); }
+        iterator begin()
+        {
+            // Continue at the row that a previous fetch looked ahead to.
+            if (std::exchange(pending, false)) return iterator(*stmt, Result::sqlite_row);
+            return iterator(*stmt);
+        }
 
         iterator end() { return iterator(); }
 
+        /**
+         * \brief Step to the next row and assign it to an existing row object. Strings and vectors in the row are
+         * overwritten in place, so that their capacity is reused between rows. Single values, tuple-like rows
+         * (including std::tuple) and aggregates with one member per column (up to max_tie_members) are assigned per
+         * column. Other row types are replaced by a newly constructed row. After the last row the statement is reset,
+         * so that the next call starts over. Should not be mixed with iterators.
+         * \param row Row to assign to. Left untouched if there are no more rows.
+         * \return True if a row was assigned, false if there are no more rows.
+         */
+        bool fetchInto(return_t& row)
+        {
+            if (!next()) return false;
+            assignRow(*stmt, row);
+            return true;
+        }
+
+        /**
+         * \brief Assign each row to the same row object and invoke a function on it. See fetchInto.
+         * \tparam F Function type.
+         * \param row Row to assign to.
+         * \param f Function that is invoked with the row after each assignment.
+         */
+        template<std::invocable<return_t&> F>
+        void forEachInto(return_t& row, F&& f)
+        {
+            while (fetchInto(row)) std::invoke(f, row);
+        }
+
+        /**
+         * \brief Step through up to maxRows rows and construct them in place in a vector. The vector is cleared and
+         * reserved once, so that its capacity is reused between batches. When the batch is full, the statement steps
+         * one row ahead to find out if more rows remain. That row is kept for the next call to fetch, fetchInto,
+         * fetchAll or begin. After the last row the statement is reset. The return type should not hold views, since
+         * these are invalidated by the next step.
+         * \param out Vector to fill with rows. Any rows inside of vector are discarded.
+         * \param maxRows Maximum number of rows. Must be positive.
+         * \return True if more rows remain, false if the last row was returned.
+         */
+        bool fetch(std::vector<return_t>& out, const size_t maxRows)
+        {
+            if (maxRows == 0) throw CppqlError("Number of rows to fetch must be positive.");
+
+            out.clear();
+            out.reserve(maxRows);
+            for (bool row = next(); row; row = step(*stmt) == Result::sqlite_row)
+            {
+                if (out.size() == maxRows)
+                {
+                    pending = true;
+                    return true;
+                }
+                emplaceRow(*stmt, out);
+            }
+            return false;
+        }
+
+        /**
+         * \brief Step through all remaining rows and return them. After the last row the statement is reset. The
+         * return type should not hold views. Should not be mixed with iterators.
+         * \return Rows.
+         */
+        [[nodiscard]] std::vector<return_t> fetchAll()
+        {
+            std::vector<return_t> rows;
+            while (next()) emplaceRow(*stmt, rows);
+            return rows;
+        }
+
         /**
          * \brief Bind parameters.
          * \tparam Self Self type.
@@ -155,6 +237,7 @@ namespace sql
         template<typename Self>
         auto&& reset(this Self&& self)
         {
+            self.pending = false;
             if (const auto res = self.stmt->reset(); !res)
                 throw SqliteError(std::format("Failed to reset select statement."), res.code, res.extendedCode);
             return std::forward<Self>(self);
@@ -168,6 +251,158 @@ namespace sql
         }
 
     private:
+        ////////////////////////////////////////////////////////////////
+        // Rows.
+        ////////////////////////////////////////////////////////////////
+
+        /**
+         * \brief Move to the next row, or use the row that fetch looked ahead to.
+         * \return True if the statement is positioned on a row, false if there are no more rows.
+         */
+        bool next()
+        {
+            if (std::exchange(pending, false)) return true;
+            return step(*stmt) == Result::sqlite_row;
+        }
+
+        /**
+         * \brief Check if the return type can be constructed with a view of column I, e.g. because it has a
+         * std::string_view or std::span member at that position.
+         */
+        template<size_t I, size_t... Is>
+        static consteval bool accepts_view(std::index_sequence<Is...>)
+        {
+            using view_t = get_column_view_t<std::tuple_element_t<I, std::tuple<Cs...>>>;
+            if constexpr (std::is_void_v<view_t>)
+                return false;
+            else
+                return std::constructible_from<return_t,
+                                               std::conditional_t<Is == I, view_t, get_column_return_t<Cs>>...>;
+        }
+
+        /**
+         * \brief Type to retrieve column I as. Views are preferred whenever the return type accepts them, which avoids
+         * copying into a temporary and keeps view members from pointing into a destroyed temporary. Such members are
+         * only valid until the next step.
+         */
+        template<size_t I>
+        using fetch_t = std::conditional_t<accepts_view<I>(std::index_sequence_for<Cs...>()),
+                                           get_column_view_t<std::tuple_element_t<I, std::tuple<Cs...>>>,
+                                           get_column_return_t<std::tuple_element_t<I, std::tuple<Cs...>>>>;
+
+        /**
+         * \brief Step the statement. Throws on error, and resets the statement after the last row.
+         * \param statement Statement.
+         * \return Result::sqlite_row or Result::sqlite_done.
+         */
+        static int32_t step(Statement& statement)
+        {
+            // Steps that return a row quickly might never reach the progress handler.
+            statement.checkCancellation();
+
+            auto res = statement.step();
+
+            if (res.code != Result::sqlite_row && res.code != Result::sqlite_done)
+            {
+                static_cast<void>(statement.reset());
+                statement.throwError(std::format("Failed to step through select statement."), res);
+            }
+
+            // Reached last row. Reset statement for next invocation.
+            if (res.code == Result::sqlite_done)
+            {
+                if (const auto r = statement.reset(); !r)
+                    throw SqliteError(std::format("Failed to reset select statement."), r.code, r.extendedCode);
+            }
+
+            return res.code;
+        }
+
+        /**
+         * \brief Construct a row from the current result row of the statement.
+         * \param statement Statement.
+         * \return Row.
+         */
+        static return_t makeRow(const Statement& statement)
+        {
+            auto f = [&statement]<std::size_t... Is>(std::index_sequence<Is...>)
+            {
+                // fetch_t<Is...> gets the type to retrieve each selected column as.
+                // statement.column(Is...) gets each column value.
+                return return_t(std::move(statement.column<fetch_t<Is>>(Is))...);
+            };
+
+            // Call f with 0, 1, sizeof...(Indices) - 1.
+            return f(std::index_sequence_for<Cs...>());
+        }
+
+        /**
+         * \brief Construct a row from the current result row of the statement at the end of a vector.
+         * \param statement Statement.
+         * \param rows Rows.
+         */
+        static void emplaceRow(const Statement& statement, std::vector<return_t>& rows)
+        {
+            [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                rows.emplace_back(statement.column<fetch_t<Is>>(Is)...);
+            }(std::index_sequence_for<Cs...>());
+        }
+
+        /**
+         * \brief Assign column I of the current result row to an existing value. Strings and vectors that match the
+         * column type are overwritten in place, reusing their capacity.
+         * \tparam I Column index.
+         * \tparam M Value type.
+         * \param statement Statement.
+         * \param value Value.
+         */
+        template<size_t I, typename M>
+        static void assignColumn(const Statement& statement, M& value)
+        {
+            using column_t = std::tuple_element_t<I, std::tuple<Cs...>>;
+
+            if constexpr (std::same_as<M, get_column_parameter_t<column_t>> ||
+                          std::same_as<M, get_column_view_t<column_t>>)
+                statement.column(static_cast<int32_t>(I), value);
+            else
+                value = statement.column<fetch_t<I>>(static_cast<int32_t>(I));
+        }
+
+        /**
+         * \brief Assign the current result row of the statement to an existing row. Single values, tuple-like rows and
+         * aggregates with one member per column are assigned per column. Other rows are replaced by a newly
+         * constructed row.
+         * \param statement Statement.
+         * \param row Row.
+         */
+        static void assignRow(const Statement& statement, return_t& row)
+        {
+            using first_t = std::tuple_element_t<0, std::tuple<Cs...>>;
+
+            // A single column that is retrieved as the row type itself, e.g. a blob as an aggregate.
+            if constexpr (sizeof...(Cs) == 1 && (std::same_as<return_t, get_column_parameter_t<first_t>> ||
+                                                 std::same_as<return_t, get_column_view_t<first_t>>))
+                assignColumn<0>(statement, row);
+            else if constexpr (requires { std::tuple_size<return_t>::value; })
+            {
+                static_assert(std::tuple_size_v<return_t> == sizeof...(Cs));
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (assignColumn<Is>(statement, std::get<Is>(row)), ...);
+                }(std::index_sequence_for<Cs...>());
+            }
+            else if constexpr (is_aggregate_with_members<return_t, sizeof...(Cs)>)
+            {
+                auto members = tieMembers<sizeof...(Cs)>(row);
+                [&]<std::size_t... Is>(std::index_sequence<Is...>) {
+                    (assignColumn<Is>(statement, std::get<Is>(members)), ...);
+                }(std::index_sequence_for<Cs...>());
+            }
+            else if constexpr (sizeof...(Cs) == 1 && std::is_assignable_v<return_t&, fetch_t<0>>)
+                assignColumn<0>(statement, row);
+            else
+                row = makeRow(statement);
+        }
+
         ////////////////////////////////////////////////////////////////
         // Member variables.
         ////////////////////////////////////////////////////////////////
@@ -181,5 +416,10 @@ namespace sql
          * \brief Pointer to filter expression.
          */
         BaseFilterExpressionPtr exp;
+
+        /**
+         * \brief Whether the statement is positioned on a row that fetch looked ahead to and has not returned yet.
+         */
+        bool pending = false;
     };
 }  // namespace sql
@@ -0,0 +1,136 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace sql
+{
+    /**
+     * \brief Maximum number of members of an aggregate that tieMembers supports.
+     */
+    inline constexpr size_t max_tie_members = 16;
+
+    /**
+     * \brief Type that converts to any member type. Only used in unevaluated contexts to count aggregate members.
+     */
+    struct _any_member
+    {
+        template<typename T>
+        operator T() const;
+    };
+
+    template<typename T, size_t... Is>
+    constexpr bool _brace_constructible(std::index_sequence<Is...>) noexcept
+    {
+        return requires { T{(static_cast<void>(Is), _any_member{})...}; };
+    }
+
+    /**
+     * \brief Check if a type is an aggregate with exactly N members that can be tied by tieMembers.
+     * \tparam T Type.
+     * \tparam N Number of members.
+     */
+    template<typename T, size_t N>
+    concept is_aggregate_with_members = std::is_aggregate_v<T> && N > 0 && N <= max_tie_members &&
+                                        _brace_constructible<T>(std::make_index_sequence<N>()) &&
+                                        !_brace_constructible<T>(std::make_index_sequence<N + 1>());
+
+    /**
+     * \brief Get a tuple of references to the members of an aggregate.
+     * \tparam N Number of members.
+     * \tparam T Aggregate type.
+     * \param value Aggregate.
+     * \return Tuple of references.
+     */
+    template<size_t N, typename T>
+        requires(is_aggregate_with_members<T, N>)
+    auto tieMembers(T& value) noexcept
+    {
+        if constexpr (N == 1)
+        {
+            auto& [m0] = value;
+            return std::tie(m0);
+        }
+        else if constexpr (N == 2)
+        {
+            auto& [m0, m1] = value;
+            return std::tie(m0, m1);
+        }
+        else if constexpr (N == 3)
+        {
+            auto& [m0, m1, m2] = value;
+            return std::tie(m0, m1, m2);
+        }
+        else if constexpr (N == 4)
+        {
+            auto& [m0, m1, m2, m3] = value;
+            return std::tie(m0, m1, m2, m3);
+        }
+        else if constexpr (N == 5)
+        {
+            auto& [m0, m1, m2, m3, m4] = value;
+            return std::tie(m0, m1, m2, m3, m4);
+        }
+        else if constexpr (N == 6)
+        {
+            auto& [m0, m1, m2, m3, m4, m5] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5);
+        }
+        else if constexpr (N == 7)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6);
+        }
+        else if constexpr (N == 8)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7);
+        }
+        else if constexpr (N == 9)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8);
+        }
+        else if constexpr (N == 10)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9);
+        }
+        else if constexpr (N == 11)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10);
+        }
+        else if constexpr (N == 12)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11);
+        }
+        else if constexpr (N == 13)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12);
+        }
+        else if constexpr (N == 14)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13);
+        }
+        else if constexpr (N == 15)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14);
+        }
+        else if constexpr (N == 16)
+        {
+            auto& [m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15] = value;
+            return std::tie(m0, m1, m2, m3, m4, m5, m6, m7, m8, m9, m10, m11, m12, m13, m14, m15);
+        }
+    }
+}  // namespace sql
@@ -305,7 +305,7 @@ namespace sql
                 return std::format("{0} {1} {2} {3}{4}",
                                    left.toString(),
                                    join_t::name,
-                                   right->getName(),
+                                   right->getQualifiedName(),
                                    filter.toString(),
                                    usingCols.toString());
             }
@@ -313,9 +313,9 @@ namespace sql
             {
                 // Left-most side of the join sequence. Left and right are both tables.
                 return std::format("{0} {1} {2} {3}{4}",
-                                   left->getName(),
+                                   left->getQualifiedName(),
                                    join_t::name,
-                                   right->getName(),
+                                   right->getQualifiedName(),
                                    filter.toString(),
                                    usingCols.toString());
             }
@@ -85,7 +85,7 @@ namespace sql
 
         [[nodiscard]] const Table& getTable() const noexcept { return *table; }
 
-        [[nodiscard]] std::string toString() const { return table->getName(); }
+        [[nodiscard]] std::string toString() const { return table->getQualifiedName(); }
 
         ////////////////////////////////////////////////////////////////
         // Columns.
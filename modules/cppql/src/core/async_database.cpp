@@ -0,0 +1,219 @@
+#include "cppql/core/async_database.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/cppql_error.h"
+
+namespace
+{
+    /**
+     * \brief Interval at which the writer thread checks for new submissions while collecting a batch.
+     */
+    constexpr auto poll_interval = std::chrono::microseconds(50);
+}  // namespace
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // Constructors.
+    ////////////////////////////////////////////////////////////////
+
+    AsyncDatabase::AsyncDatabase(DatabasePtr db, const GroupCommitPolicy& p) :
+        database(std::move(db)), policy(p), head(&stub), tail(&stub)
+    {
+        if (!database) throw CppqlError("Cannot create AsyncDatabase without a database.");
+        if (policy.maxBatchSize == 0) throw CppqlError("Group commit batch size must be at least 1.");
+
+        thread = std::jthread([this](const std::stop_token& stop) { run(stop); });
+    }
+
+    AsyncDatabase::~AsyncDatabase() noexcept
+    {
+        thread.request_stop();
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
+        if (thread.joinable()) thread.join();
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    size_t AsyncDatabase::getPendingCount() const noexcept { return pending.load(std::memory_order_relaxed); }
+
+    const GroupCommitPolicy& AsyncDatabase::getPolicy() const noexcept { return policy; }
+
+    AsyncDatabaseStats AsyncDatabase::getStats() const
+    {
+        std::scoped_lock lock(statsMutex);
+        return stats;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Queue.
+    ////////////////////////////////////////////////////////////////
+
+    void AsyncDatabase::push(Task* task) noexcept
+    {
+        pending.fetch_add(1, std::memory_order_relaxed);
+        enqueue(task);
+        signal.fetch_add(1, std::memory_order_release);
+        signal.notify_one();
+    }
+
+    void AsyncDatabase::enqueue(Node* node) noexcept
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        // Between the exchange and the store the node is unreachable from the tail, which the writer thread sees as
+        // an empty queue. The signal that follows every push wakes it up again.
+        Node* prev = head.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    AsyncDatabase::Task* AsyncDatabase::dequeue() noexcept
+    {
+        Node* node = tail;
+        Node* next = node->next.load(std::memory_order_acquire);
+
+        // Skip the stub.
+        if (node == &stub)
+        {
+            if (!next) return nullptr;
+            tail = next;
+            node = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+
+        if (next)
+        {
+            tail = next;
+            return static_cast<Task*>(node);
+        }
+
+        // The node is the last one. It can only be removed once another node follows it, so put the stub back.
+        if (node != head.load(std::memory_order_acquire)) return nullptr;
+        enqueue(&stub);
+        next = node->next.load(std::memory_order_acquire);
+        if (next)
+        {
+            tail = next;
+            return static_cast<Task*>(node);
+        }
+
+        return nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Writer thread.
+    ////////////////////////////////////////////////////////////////
+
+    void AsyncDatabase::run(const std::stop_token& stop)
+    {
+        std::vector<Task*> batch;
+        batch.reserve(policy.maxBatchSize);
+
+        while (true)
+        {
+            const auto seq = signal.load(std::memory_order_acquire);
+
+            if (auto* task = dequeue())
+            {
+                batch.push_back(task);
+                collect(batch, stop);
+                execute(batch);
+                continue;
+            }
+
+            // Everything that was submitted before stopping has run.
+            if (stop.stop_requested() && pending.load(std::memory_order_relaxed) == 0) break;
+
+            signal.wait(seq, std::memory_order_acquire);
+        }
+    }
+
+    void AsyncDatabase::collect(std::vector<Task*>& batch, const std::stop_token& stop)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + policy.maxLatency;
+        while (batch.size() < policy.maxBatchSize)
+        {
+            if (auto* task = dequeue())
+            {
+                batch.push_back(task);
+                continue;
+            }
+
+            // Do not delay shutdown.
+            const auto now = std::chrono::steady_clock::now();
+            if (now >= deadline || stop.stop_requested()) break;
+            std::this_thread::sleep_for(std::min<std::chrono::nanoseconds>(deadline - now, poll_interval));
+        }
+    }
+
+    void AsyncDatabase::execute(std::vector<Task*>& batch)
+    {
+        const auto count     = batch.size();
+        bool       committed = true;
+
+        if (policy.maxBatchSize == 1)
+        {
+            for (auto* task : batch) task->run(*database);
+        }
+        else
+        {
+            committed = false;
+            try
+            {
+                Transaction transaction(*database, Transaction::Type::Immediate);
+                for (auto* task : batch)
+                {
+                    Savepoint savepoint(*database);
+                    task->run(*database);
+                    if (task->failed())
+                        savepoint.rollback();
+                    else
+                        savepoint.release();
+                }
+                transaction.commit();
+                committed = true;
+            }
+            catch (...)
+            {
+                // A failed commit leaves the transaction open.
+                if (!sqlite3_get_autocommit(database->get()))
+                    sqlite3_exec(database->get(), "ROLLBACK;", nullptr, nullptr, nullptr);
+
+                const auto error = std::current_exception();
+                for (auto* task : batch) task->fail(error);
+            }
+        }
+
+        {
+            std::scoped_lock lock(statsMutex);
+            stats.submissions += static_cast<int64_t>(count);
+            if (policy.maxBatchSize > 1) stats.batches++;
+            if (!committed) stats.failedBatches++;
+        }
+
+        for (auto* task : batch)
+        {
+            if (committed) task->complete();
+            delete task;
+        }
+        batch.clear();
+        pending.fetch_sub(count, std::memory_order_relaxed);
+    }
+}  // namespace sql
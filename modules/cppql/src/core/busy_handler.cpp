@@ -0,0 +1,105 @@
+#include "cppql/core/busy_handler.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <thread>
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // Constructors.
+    ////////////////////////////////////////////////////////////////
+
+    BusyHandler::BusyHandler(const BusyPolicy& p) : policy(p), rng(std::random_device{}()) {}
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    const BusyPolicy& BusyHandler::getPolicy() const noexcept { return policy; }
+
+    BusyStats BusyHandler::getStats() const noexcept
+    {
+        return {.busyCount    = busyCount.load(std::memory_order_relaxed),
+                .retryCount   = retryCount.load(std::memory_order_relaxed),
+                .timeoutCount = timeoutCount.load(std::memory_order_relaxed),
+                .waitTime     = std::chrono::microseconds(waitTime.load(std::memory_order_relaxed))};
+    }
+
+    void BusyHandler::resetStats() noexcept
+    {
+        busyCount.store(0, std::memory_order_relaxed);
+        retryCount.store(0, std::memory_order_relaxed);
+        timeoutCount.store(0, std::memory_order_relaxed);
+        waitTime.store(0, std::memory_order_relaxed);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // ...
+    ////////////////////////////////////////////////////////////////
+
+    std::chrono::microseconds BusyHandler::backoff(const int32_t count)
+    {
+        // Double the delay on every retry. Cap the shift to prevent overflow.
+        const auto shift = std::clamp<int32_t>(count, 0, 30);
+        const auto delay = std::min(policy.initialDelay * (int64_t{1} << shift), policy.maxDelay);
+
+        // Randomly shorten delay by up to the jitter fraction.
+        const auto jitter = std::clamp(policy.jitter, 0.0, 1.0);
+        std::uniform_real_distribution dist(1.0 - jitter, 1.0);
+        return std::chrono::microseconds(static_cast<int64_t>(static_cast<double>(delay.count()) * dist(rng)));
+    }
+
+    bool BusyHandler::wait(const int32_t count)
+    {
+        // sqlite restarts the count for every new busy event.
+        if (count == 0)
+        {
+            elapsed = std::chrono::microseconds(0);
+            busyCount.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        const auto delay = backoff(count);
+        if (elapsed + delay > policy.maxWait)
+        {
+            timeoutCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        elapsed += sleep(delay);
+        return true;
+    }
+
+    bool BusyHandler::retry(const int32_t count, const std::chrono::microseconds spent)
+    {
+        const auto delay = backoff(count);
+        if (spent + delay > policy.maxWait)
+        {
+            timeoutCount.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        static_cast<void>(sleep(delay));
+        return true;
+    }
+
+    std::chrono::microseconds BusyHandler::sleep(const std::chrono::microseconds delay)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        std::this_thread::sleep_for(delay);
+        const auto slept =
+          std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        retryCount.fetch_add(1, std::memory_order_relaxed);
+        waitTime.fetch_add(slept.count(), std::memory_order_relaxed);
+        return slept;
+    }
+
+    int32_t BusyHandler::callback(void* handler, const int32_t count) noexcept
+    {
+        return static_cast<BusyHandler*>(handler)->wait(count) ? 1 : 0;
+    }
+}  // namespace sql
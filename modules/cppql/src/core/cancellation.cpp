@@ -0,0 +1,76 @@
+#include "cppql/core/cancellation.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <utility>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/database.h"
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // CancellationToken.
+    ////////////////////////////////////////////////////////////////
+
+    CancellationToken::CancellationToken() : cancelled(std::make_shared<std::atomic<bool>>(false)) {}
+
+    void CancellationToken::cancel() const noexcept { cancelled->store(true, std::memory_order_release); }
+
+    bool CancellationToken::isCancelled() const noexcept { return cancelled->load(std::memory_order_acquire); }
+
+    ////////////////////////////////////////////////////////////////
+    // CancellationScope.
+    ////////////////////////////////////////////////////////////////
+
+    CancellationScope::CancellationScope(Database& db, CancellationToken t) : database(&db), token(std::move(t))
+    {
+        database->pushCancellationScope(*this);
+    }
+
+    CancellationScope::CancellationScope(Database& db, const std::chrono::steady_clock::time_point d) :
+        database(&db), deadline(d)
+    {
+        database->pushCancellationScope(*this);
+    }
+
+    CancellationScope::CancellationScope(Database& db, const std::chrono::nanoseconds timeout) :
+        CancellationScope(db,
+                          std::chrono::steady_clock::now() +
+                            std::chrono::duration_cast<std::chrono::steady_clock::duration>(timeout))
+    {
+    }
+
+    CancellationScope::CancellationScope(Database&                                   db,
+                                         const std::chrono::steady_clock::time_point d,
+                                         CancellationToken                           t) :
+        database(&db), deadline(d), token(std::move(t))
+    {
+        database->pushCancellationScope(*this);
+    }
+
+    CancellationScope::~CancellationScope() noexcept { database->popCancellationScope(*this); }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    const std::optional<std::chrono::steady_clock::time_point>& CancellationScope::getDeadline() const noexcept
+    {
+        return deadline;
+    }
+
+    const std::optional<CancellationToken>& CancellationScope::getToken() const noexcept { return token; }
+
+    std::optional<InterruptReason> CancellationScope::check() const noexcept
+    {
+        if (token && token->isCancelled()) return InterruptReason::Cancelled;
+        if (deadline && std::chrono::steady_clock::now() >= *deadline) return InterruptReason::Deadline;
+        return std::nullopt;
+    }
+}  // namespace sql
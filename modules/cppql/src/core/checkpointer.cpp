@@ -0,0 +1,196 @@
+#include "cppql/core/checkpointer.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <format>
+#include <string>
+#include <string_view>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/database.h"
+#include "cppql/error/cppql_error.h"
+#include "cppql/error/sqlite_error.h"
+
+namespace sql
+{
+    namespace
+    {
+        [[nodiscard]] int32_t toSqlite(const CheckpointMode mode) noexcept
+        {
+            switch (mode)
+            {
+            case CheckpointMode::Passive: return SQLITE_CHECKPOINT_PASSIVE;
+            case CheckpointMode::Full: return SQLITE_CHECKPOINT_FULL;
+            case CheckpointMode::Restart: return SQLITE_CHECKPOINT_RESTART;
+            case CheckpointMode::Truncate: return SQLITE_CHECKPOINT_TRUNCATE;
+            }
+
+            return SQLITE_CHECKPOINT_PASSIVE;
+        }
+
+        template<typename T>
+        [[nodiscard]] T readPragma(Database& db, const std::string& name)
+        {
+            const auto stmt = db.createStatement(std::format("PRAGMA {};", name), true);
+            if (!stmt.isPrepared())
+                throw SqliteError(std::format("Failed to prepare statement \"{}\".", stmt.getSql()),
+                                  stmt.getResult()->code,
+                                  stmt.getResult()->extendedCode);
+            if (const auto res = stmt.step(); res.code != SQLITE_ROW)
+                throw SqliteError(std::format("Failed to read PRAGMA {}.", name), res.code, res.extendedCode);
+            return stmt.column<T>(0);
+        }
+    }  // namespace
+
+    ////////////////////////////////////////////////////////////////
+    // Constructors.
+    ////////////////////////////////////////////////////////////////
+
+    Checkpointer::Checkpointer(Database& db, const CheckpointPolicy& p) : database(db.get()), policy(p)
+    {
+        const char* filename = sqlite3_db_filename(database, "main");
+        if (!filename || *filename == '\0')
+            throw CppqlError("Cannot attach checkpointer to an in-memory or temporary database.");
+        if (const auto mode = readPragma<std::string>(db, "journal_mode"); mode != "wal")
+            throw CppqlError(std::format("Cannot attach checkpointer to a database in journal mode {}.", mode));
+
+        DatabaseOptions options;
+        options.busyTimeout   = policy.busyTimeout;
+        options.schemaLoading = SchemaLoading::Lazy;
+        connection            = Database::open(filename, options);
+        connection->setClose(Database::Close::V2);
+        connection->setShutdown(Database::Shutdown::Off);
+
+        // Installing a WAL hook replaces the automatic checkpoints, which are themselves implemented as a WAL hook.
+        autocheckpoint = readPragma<int32_t>(db, "wal_autocheckpoint");
+        sqlite3_wal_hook(database, &Checkpointer::callback, this);
+
+        thread = std::jthread([this](const std::stop_token& stop) { run(stop); });
+    }
+
+    Checkpointer::~Checkpointer() noexcept
+    {
+        // Restore automatic checkpoints. This replaces the hook. The hook runs while the database mutex is held, so
+        // once this returns no commit can reach this checkpointer anymore.
+        sqlite3_wal_autocheckpoint(database, autocheckpoint);
+
+        thread.request_stop();
+        if (thread.joinable()) thread.join();
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    const CheckpointPolicy& Checkpointer::getPolicy() const noexcept { return policy; }
+
+    CheckpointStats Checkpointer::getStats() const
+    {
+        std::scoped_lock lock(mutex);
+        return stats;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // ...
+    ////////////////////////////////////////////////////////////////
+
+    void Checkpointer::request()
+    {
+        {
+            std::scoped_lock lock(mutex);
+            requested = true;
+        }
+        condition.notify_one();
+    }
+
+    int32_t Checkpointer::callback(void* context, sqlite3*, const char* schema, const int32_t frames) noexcept
+    {
+        if (std::string_view(schema) != "main") return SQLITE_OK;
+
+        auto&      checkpointer = *static_cast<Checkpointer*>(context);
+        const bool due          = [&] {
+            std::scoped_lock lock(checkpointer.mutex);
+            // A WAL that got smaller was restarted, and none of its frames are checkpointed yet.
+            if (frames < checkpointer.walFrames) checkpointer.checkpointedFrames = 0;
+            checkpointer.walFrames = frames;
+            return checkpointer.walFrames - checkpointer.checkpointedFrames >= checkpointer.policy.walFrames;
+        }();
+        if (due) checkpointer.condition.notify_one();
+
+        return SQLITE_OK;
+    }
+
+    void Checkpointer::run(const std::stop_token& stop)
+    {
+        std::unique_lock lock(mutex);
+        while (!stop.stop_requested())
+        {
+            const auto due = condition.wait_for(lock, stop, policy.interval, [this] {
+                return requested || walFrames - checkpointedFrames >= policy.walFrames;
+            });
+            if (stop.stop_requested()) break;
+
+            // The interval elapsed and there is nothing to checkpoint.
+            if (!due && walFrames == checkpointedFrames) continue;
+
+            requested = false;
+            lock.unlock();
+            checkpoint();
+            lock.lock();
+        }
+    }
+
+    void Checkpointer::checkpoint()
+    {
+        int32_t    log   = -1;
+        int32_t    ckpt  = -1;
+        const auto start = std::chrono::steady_clock::now();
+        const auto res   = sqlite3_wal_checkpoint_v2(connection->get(), nullptr, toSqlite(policy.mode), &log, &ckpt);
+        const auto time  = std::chrono::steady_clock::now() - start;
+
+        std::scoped_lock lock(mutex);
+        stats.checkpoints++;
+        stats.lastTime = time;
+        stats.totalTime += time;
+
+        // A busy checkpoint still copies as many frames as it can.
+        if (res == SQLITE_BUSY)
+            stats.busyCount++;
+        else if (res != SQLITE_OK)
+        {
+            stats.errorCount++;
+            return;
+        }
+
+        if (log < 0 || ckpt < 0) return;
+
+        // The reported number of checkpointed frames counts from the start of the WAL. A restart of the WAL is detected
+        // by the callback. A successful truncating checkpoint reports 0 for both.
+        stats.walFrames = log;
+        if (res == SQLITE_OK && policy.mode == CheckpointMode::Truncate)
+        {
+            stats.framesCheckpointed += walFrames - checkpointedFrames;
+            walFrames          = 0;
+            checkpointedFrames = 0;
+        }
+        else
+        {
+            stats.framesCheckpointed += ckpt >= checkpointedFrames ? ckpt - checkpointedFrames : ckpt;
+            // Commits made while the checkpoint was running may already have grown the WAL further.
+            walFrames          = std::max<int64_t>(walFrames, log);
+            checkpointedFrames = ckpt;
+        }
+    }
+}  // namespace sql
@@ -4,7 +4,12 @@
 // Standard includes.
 ////////////////////////////////////////////////////////////////
 
+#include <algorithm>
+#include <cctype>
+#include <chrono>
 #include <format>
+#include <optional>
+#include <thread>
 
 ////////////////////////////////////////////////////////////////
 // External includes.
@@ -21,14 +26,134 @@
 
 namespace sql
 {
+    namespace
+    {
+        /**
+         * \brief Construct a Database from a freshly opened handle. Closes the handle if applying the options or
+         * reading the schema fails, so that no half-configured connection is left behind.
+         */
+        DatabasePtr makeDatabase(sqlite3* db, const DatabaseOptions& options)
+        {
+            try
+            {
+                return std::make_unique<Database>(db, options);
+            }
+            catch (...)
+            {
+                sqlite3_close_v2(db);
+                throw;
+            }
+        }
+
+        /**
+         * \brief Copy the main database of source into destination.
+         */
+        void backup(sqlite3* destination, sqlite3* source, const BackupOptions& options)
+        {
+            auto* handle = sqlite3_backup_init(destination, "main", source, "main");
+            if (!handle)
+                throw SqliteError(std::format("Failed to start backup: {}", sqlite3_errmsg(destination)),
+                                  sqlite3_errcode(destination),
+                                  sqlite3_extended_errcode(destination));
+
+            auto res         = SQLITE_OK;
+            auto lockedSince = std::optional<std::chrono::steady_clock::time_point>{};
+            try
+            {
+                for (;;)
+                {
+                    res = sqlite3_backup_step(handle, options.pagesPerStep);
+                    if (options.progress)
+                        options.progress(sqlite3_backup_remaining(handle), sqlite3_backup_pagecount(handle));
+                    if (res != SQLITE_OK && res != SQLITE_BUSY && res != SQLITE_LOCKED) break;
+
+                    // Give up when a lock is held for too long.
+                    if (res == SQLITE_OK)
+                        lockedSince.reset();
+                    else
+                    {
+                        const auto now = std::chrono::steady_clock::now();
+                        if (!lockedSince) lockedSince = now;
+                        if (now - *lockedSince >= options.busyTimeout) break;
+                    }
+
+                    // Yield to other connections. Locked databases are retried after sleeping as well.
+                    if (options.sleep.count() > 0) std::this_thread::sleep_for(options.sleep);
+                }
+            }
+            catch (...)
+            {
+                static_cast<void>(sqlite3_backup_finish(handle));
+                throw;
+            }
+
+            const auto finish = sqlite3_backup_finish(handle);
+            if (res == SQLITE_BUSY || res == SQLITE_LOCKED)
+                throw SqliteError(
+                  std::format("Failed to backup database. It stayed locked for {}ms.", options.busyTimeout.count()),
+                  res,
+                  sqlite3_extended_errcode(destination));
+            if (res != SQLITE_DONE)
+                throw SqliteError(std::format("Failed to backup database."), res, sqlite3_extended_errcode(destination));
+            if (finish != SQLITE_OK)
+                throw SqliteError(
+                  std::format("Failed to finish backup."), finish, sqlite3_extended_errcode(destination));
+        }
+
+        int32_t toLimitCode(const Database::Limit limit) noexcept
+        {
+            switch (limit)
+            {
+            case Database::Limit::Length: return SQLITE_LIMIT_LENGTH;
+            case Database::Limit::SqlLength: return SQLITE_LIMIT_SQL_LENGTH;
+            case Database::Limit::Column: return SQLITE_LIMIT_COLUMN;
+            case Database::Limit::ExprDepth: return SQLITE_LIMIT_EXPR_DEPTH;
+            case Database::Limit::CompoundSelect: return SQLITE_LIMIT_COMPOUND_SELECT;
+            case Database::Limit::VdbeOp: return SQLITE_LIMIT_VDBE_OP;
+            case Database::Limit::FunctionArg: return SQLITE_LIMIT_FUNCTION_ARG;
+            case Database::Limit::Attached: return SQLITE_LIMIT_ATTACHED;
+            case Database::Limit::LikePatternLength: return SQLITE_LIMIT_LIKE_PATTERN_LENGTH;
+            case Database::Limit::VariableNumber: return SQLITE_LIMIT_VARIABLE_NUMBER;
+            case Database::Limit::TriggerDepth: return SQLITE_LIMIT_TRIGGER_DEPTH;
+            case Database::Limit::WorkerThreads: return SQLITE_LIMIT_WORKER_THREADS;
+            }
+            return SQLITE_LIMIT_LENGTH;
+        }
+
+        /**
+         * \brief Get the current value of a sqlite3_db_status counter.
+         */
+        int64_t getDbStatus(sqlite3* db, const int32_t op)
+        {
+            int32_t current = 0, highwater = 0;
+            if (const auto res = sqlite3_db_status(db, op, &current, &highwater, 0); res != SQLITE_OK)
+                throw SqliteError(std::format("Failed to get database status {}.", op), res, SQLITE_OK);
+            return current;
+        }
+    }  // namespace
+
     Database::Database(sqlite3* database) : db(database) { initializeTables(); }
 
+    Database::Database(sqlite3* database, const DatabaseOptions& options) :
+        db(database), schemaLoading(options.schemaLoading.value_or(SchemaLoading::Eager))
+    {
+        applyOptions(options);
+        initializeTables();
+    }
+
     Database::~Database()
     {
         int32_t res = SQLITE_OK;
 
         if (db)
         {
+            // Cached statements must be finalized before the connection can be closed. Persistent statements are
+            // released into the cache, so they go first.
+            persistentStatements.clear();
+            statementCache.clear();
+
+            // Stop background thread before closing the connection it is attached to.
+            checkpointer.reset();
 
             switch (close)
             {
@@ -40,11 +165,8 @@ namespace sql
             CPPQL_ASSERT(res == SQLITE_OK);
         }
 
-        if (shutdown == Shutdown::On)
-        {
-            res = sqlite3_shutdown();
-            CPPQL_ASSERT(res == SQLITE_OK);
-        }
+        // Shut down when the runtime reference is released, after all other members were destroyed.
+        runtime.setShutdown(shutdown == Shutdown::On);
 
         static_cast<void>(res);
     }
@@ -54,6 +176,11 @@ namespace sql
     ////////////////////////////////////////////////////////////////
 
     DatabasePtr Database::create(const std::filesystem::path& file, const int32_t flags)
+    {
+        return create(file, DatabaseOptions{}, flags);
+    }
+
+    DatabasePtr Database::create(const std::filesystem::path& file, const DatabaseOptions& options, const int32_t flags)
     {
         if (!(flags & SQLITE_OPEN_MEMORY) && exists(file))
             throw CppqlError(
@@ -66,11 +193,15 @@ namespace sql
             res != SQLITE_OK)
             throw SqliteError(std::format("Failed to create database at {}.", file.string()), res, SQLITE_OK);
 
-
-        return std::make_unique<Database>(db);
+        return makeDatabase(db, options);
     }
 
     DatabasePtr Database::open(const std::filesystem::path& file, const int32_t flags)
+    {
+        return open(file, DatabaseOptions{}, flags);
+    }
+
+    DatabasePtr Database::open(const std::filesystem::path& file, const DatabaseOptions& options, const int32_t flags)
     {
         if (!(flags & SQLITE_OPEN_MEMORY) && !exists(file))
             throw CppqlError(std::format("Failed to open database at {}. File does not exist", file.string()));
@@ -81,10 +212,16 @@ namespace sql
             res != SQLITE_OK)
             throw SqliteError(std::format("Failed to open database at {}.", file.string()), res, SQLITE_OK);
 
-        return std::make_unique<Database>(db);
+        return makeDatabase(db, options);
     }
 
     std::pair<DatabasePtr, bool> Database::openOrCreate(const std::filesystem::path& file, const int32_t flags)
+    {
+        return openOrCreate(file, DatabaseOptions{}, flags);
+    }
+
+    std::pair<DatabasePtr, bool>
+      Database::openOrCreate(const std::filesystem::path& file, const DatabaseOptions& options, const int32_t flags)
     {
         const bool created = !exists(file);
 
@@ -95,7 +232,45 @@ namespace sql
             res != SQLITE_OK)
             throw SqliteError(std::format("Failed to open database at {}.", file.string()), res, SQLITE_OK);
 
-        return std::make_pair(std::make_unique<Database>(db), created);
+        return std::make_pair(makeDatabase(db, options), created);
+    }
+
+    DatabasePtr Database::deserialize(const std::span<const std::byte> data, const DatabaseOptions& options)
+    {
+        sqlite3* db = nullptr;
+        if (const auto res = sqlite3_open_v2(
+              ":memory:", &db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_MEMORY, nullptr);
+            res != SQLITE_OK)
+        {
+            sqlite3_close_v2(db);
+            throw SqliteError(std::format("Failed to open in-memory database."), res, SQLITE_OK);
+        }
+
+        // sqlite takes ownership of the buffer, which must be allocated with sqlite3_malloc. It can grow the buffer
+        // when the database is modified.
+        auto* buffer = static_cast<std::byte*>(sqlite3_malloc64(data.size()));
+        if (!buffer && !data.empty())
+        {
+            sqlite3_close_v2(db);
+            throw SqliteError(std::format("Failed to allocate {} bytes.", data.size()), SQLITE_NOMEM, SQLITE_OK);
+        }
+        std::ranges::copy(data, buffer);
+
+        const auto size = static_cast<sqlite3_int64>(data.size());
+        if (const auto res = sqlite3_deserialize(db,
+                                                 "main",
+                                                 reinterpret_cast<unsigned char*>(buffer),
+                                                 size,
+                                                 size,
+                                                 SQLITE_DESERIALIZE_FREEONCLOSE | SQLITE_DESERIALIZE_RESIZEABLE);
+            res != SQLITE_OK)
+        {
+            // The buffer is freed by sqlite3_deserialize on failure.
+            sqlite3_close_v2(db);
+            throw SqliteError(std::format("Failed to deserialize database."), res, SQLITE_OK);
+        }
+
+        return makeDatabase(db, options);
     }
 
     ////////////////////////////////////////////////////////////////
@@ -110,11 +285,13 @@ namespace sql
 
     Table& Database::getTable(const std::string& name)
     {
-        const auto it = tables.find(name);
-        if (it == tables.end()) throw CppqlError(std::format("A table with the name {} does not exist", name));
-        return *it->second;
+        if (const auto it = tables.find(name); it != tables.end()) return *it->second;
+        if (unloadedTables.contains(name)) return loadTable(name);
+        throw CppqlError(std::format("A table with the name {} does not exist", name));
     }
 
+    bool Database::isAttached(const std::string& alias) const { return attachedSchemas.contains(alias); }
+
     int64_t Database::getLastInsertRowId() const noexcept { return sqlite3_last_insert_rowid(db); }
 
     int64_t Database::getChanges() const noexcept { return sqlite3_changes64(db); }
@@ -123,6 +300,84 @@ namespace sql
 
     std::string Database::getErrorMessage() const { return {sqlite3_errmsg(db)}; }
 
+    StatementCache& Database::getStatementCache() noexcept { return statementCache; }
+
+    const StatementCache& Database::getStatementCache() const noexcept { return statementCache; }
+
+    BusyHandler* Database::getBusyHandler() const noexcept { return busyHandler.get(); }
+
+    BusyStats Database::getBusyStats() const noexcept { return busyHandler ? busyHandler->getStats() : BusyStats{}; }
+
+    const SlowQueryLog* Database::getSlowQueryLog() const noexcept { return slowQueryLog.get(); }
+
+    Checkpointer* Database::getCheckpointer() const noexcept { return checkpointer.get(); }
+
+    int32_t Database::getLimit(const Limit limit) const noexcept { return sqlite3_limit(db, toLimitCode(limit), -1); }
+
+    ConnectionMemory Database::getMemoryUsage() const
+    {
+        return {.cacheUsed     = getDbStatus(db, SQLITE_DBSTATUS_CACHE_USED),
+                .statementUsed = getDbStatus(db, SQLITE_DBSTATUS_STMT_USED)};
+    }
+
+    const std::optional<MemoryBudget>& Database::getMemoryBudget() const noexcept { return memoryBudget; }
+
+    DatabaseStats Database::getStats(const bool reset) const
+    {
+        // Returns the current value and the highwater mark. Some counters only report one of them.
+        const auto get = [&](const int32_t op) {
+            int32_t current = 0, highwater = 0;
+            if (const auto res = sqlite3_db_status(db, op, &current, &highwater, reset ? 1 : 0); res != SQLITE_OK)
+                throw SqliteError(std::format("Failed to get database status {}.", op), res, SQLITE_OK);
+            return std::make_pair(static_cast<int64_t>(current), static_cast<int64_t>(highwater));
+        };
+
+        DatabaseStats stats;
+        stats.cacheHits         = get(SQLITE_DBSTATUS_CACHE_HIT).first;
+        stats.cacheMisses       = get(SQLITE_DBSTATUS_CACHE_MISS).first;
+        stats.cacheWrites       = get(SQLITE_DBSTATUS_CACHE_WRITE).first;
+        stats.cacheSpills       = get(SQLITE_DBSTATUS_CACHE_SPILL).first;
+        stats.cacheUsed         = get(SQLITE_DBSTATUS_CACHE_USED).first;
+        stats.lookasideHits     = get(SQLITE_DBSTATUS_LOOKASIDE_HIT).second;
+        stats.lookasideMissSize = get(SQLITE_DBSTATUS_LOOKASIDE_MISS_SIZE).second;
+        stats.lookasideMissFull = get(SQLITE_DBSTATUS_LOOKASIDE_MISS_FULL).second;
+        stats.schemaUsed        = get(SQLITE_DBSTATUS_SCHEMA_USED).first;
+        stats.statementUsed     = get(SQLITE_DBSTATUS_STMT_USED).first;
+
+        // Both values must be read at once, because resetting clears the highwater mark.
+        const auto [lookasideUsed, lookasideHighwater] = get(SQLITE_DBSTATUS_LOOKASIDE_USED);
+        stats.lookasideUsed                            = lookasideUsed;
+        stats.lookasideHighwater                       = lookasideHighwater;
+        return stats;
+    }
+
+    int64_t Database::getFreePageCount() { return getPragma<int64_t>("freelist_count").value_or(0); }
+
+    DatabaseOptions Database::getOptions()
+    {
+        DatabaseOptions options;
+        if (const auto value = getPragma<std::string>("journal_mode"))
+            fromString(*value, options.journalMode.emplace());
+        if (const auto value = getPragma<std::string>("locking_mode"))
+            fromString(*value, options.lockingMode.emplace());
+        if (const auto value = getPragma<int64_t>("synchronous"))
+            options.synchronous = static_cast<Synchronous>(*value);
+        if (const auto value = getPragma<int64_t>("temp_store"))
+            options.tempStore = static_cast<TempStore>(*value);
+        if (const auto value = getPragma<int64_t>("foreign_keys"))
+            options.foreignKeys = *value != 0;
+        if (const auto value = getPragma<int64_t>("auto_vacuum"))
+            options.autoVacuum = static_cast<AutoVacuum>(*value);
+        if (const auto value = getPragma<int64_t>("busy_timeout"))
+            options.busyTimeout = std::chrono::milliseconds(*value);
+        options.cacheSize         = getPragma<int64_t>("cache_size");
+        options.pageSize          = getPragma<int64_t>("page_size");
+        options.mmapSize          = getPragma<int64_t>("mmap_size");
+        options.walAutocheckpoint = getPragma<int64_t>("wal_autocheckpoint");
+        options.schemaLoading     = schemaLoading;
+        return options;
+    }
+
     ////////////////////////////////////////////////////////////////
     // Setters.
     ////////////////////////////////////////////////////////////////
@@ -131,10 +386,169 @@ namespace sql
 
     void Database::setShutdown(const Shutdown value) noexcept { shutdown = value; }
 
+    void Database::applyOptions(const DatabaseOptions& options)
+    {
+        // Lookaside memory can only be reconfigured while none of it is in use, i.e. before any statement is prepared.
+        if (options.lookaside)
+        {
+            if (const auto res = sqlite3_db_config(
+                  db, SQLITE_DBCONFIG_LOOKASIDE, nullptr, options.lookaside->slotSize, options.lookaside->slots);
+                res != SQLITE_OK)
+                throw SqliteError(std::format("Failed to configure lookaside memory."), res, SQLITE_OK);
+        }
+
+        // The page size is fixed once the first page is written or WAL mode is enabled, so it goes first.
+        if (options.pageSize) setPragma("page_size", std::to_string(*options.pageSize));
+
+        // Like the page size, auto vacuum can only be enabled before any table is created or WAL mode is enabled.
+        if (options.autoVacuum) setPragma("auto_vacuum", toString(*options.autoVacuum));
+
+        // In exclusive locking mode, WAL mode does not need a shared memory file. This only works if the locking mode
+        // is set before the journal mode.
+        if (options.lockingMode) setPragma("locking_mode", toString(*options.lockingMode));
+
+        if (options.journalMode)
+        {
+            // Switching journal mode fails silently (e.g. WAL on an in-memory database), so check the result.
+            setPragma("journal_mode", toString(*options.journalMode));
+            JournalMode mode = *options.journalMode;
+            if (const auto value = getPragma<std::string>("journal_mode")) fromString(*value, mode);
+            if (mode != *options.journalMode)
+                throw CppqlError(std::format("Failed to set journal mode to {}. Journal mode is {}.",
+                                             toString(*options.journalMode),
+                                             toString(mode)));
+        }
+
+        if (options.synchronous) setPragma("synchronous", toString(*options.synchronous));
+        if (options.cacheSize) setPragma("cache_size", std::to_string(*options.cacheSize));
+        if (options.mmapSize) setPragma("mmap_size", std::to_string(*options.mmapSize));
+        if (options.tempStore) setPragma("temp_store", toString(*options.tempStore));
+        if (options.foreignKeys) setPragma("foreign_keys", *options.foreignKeys ? "ON" : "OFF");
+        if (options.walAutocheckpoint) setPragma("wal_autocheckpoint", std::to_string(*options.walAutocheckpoint));
+
+        if (options.busyTimeout)
+        {
+            if (const auto res = sqlite3_busy_timeout(db, static_cast<int32_t>(options.busyTimeout->count()));
+                res != SQLITE_OK)
+                throw SqliteError(std::format("Failed to set busy timeout."), res, SQLITE_OK);
+
+            // The timeout replaced any busy handler.
+            busyHandler.reset();
+        }
+
+        if (options.busyPolicy) setBusyPolicy(*options.busyPolicy);
+    }
+
+    void Database::setBusyPolicy(const BusyPolicy& policy)
+    {
+        auto handler = std::make_unique<BusyHandler>(policy);
+        if (const auto res = sqlite3_busy_handler(db, &BusyHandler::callback, handler.get()); res != SQLITE_OK)
+            throw SqliteError(std::format("Failed to set busy handler."), res, SQLITE_OK);
+        busyHandler = std::move(handler);
+    }
+
+    void Database::clearBusyPolicy()
+    {
+        if (const auto res = sqlite3_busy_handler(db, nullptr, nullptr); res != SQLITE_OK)
+            throw SqliteError(std::format("Failed to clear busy handler."), res, SQLITE_OK);
+        busyHandler.reset();
+    }
+
+    void Database::setProgressHandler(const int32_t instructions, std::function<bool()> callback)
+    {
+        if (!progressHandler) progressHandler = std::make_unique<ProgressHandler>();
+        progressHandler->setCallback(instructions, std::move(callback));
+        updateProgressHandler();
+    }
+
+    void Database::clearProgressHandler()
+    {
+        if (!progressHandler) return;
+        progressHandler->clearCallback();
+        updateProgressHandler();
+    }
+
+    int32_t Database::setLimit(const Limit limit, const int32_t value)
+    {
+        if (value < 0) throw CppqlError("Limit must not be negative.");
+        return sqlite3_limit(db, toLimitCode(limit), value);
+    }
+
+    void Database::setMemoryBudget(MemoryBudget budget)
+    {
+        if (budget.checkInterval <= 0) throw CppqlError("Memory budget check interval must be positive.");
+        budgetCountdown = budget.checkInterval;
+        memoryBudget    = std::move(budget);
+    }
+
+    void Database::clearMemoryBudget() noexcept { memoryBudget.reset(); }
+
+    void Database::setSlowQueryLog(const std::chrono::nanoseconds threshold, SlowQuerySinkPtr sink)
+    {
+        auto log = std::make_unique<SlowQueryLog>(threshold, std::move(sink));
+        if (const auto res = sqlite3_trace_v2(db,
+                                              SQLITE_TRACE_PROFILE | SQLITE_TRACE_ROW,
+                                              &SlowQueryLog::callback,
+                                              log.get());
+            res != SQLITE_OK)
+            throw SqliteError(std::format("Failed to set slow query log."), res, SQLITE_OK);
+        slowQueryLog = std::move(log);
+    }
+
+    void Database::clearSlowQueryLog()
+    {
+        if (const auto res = sqlite3_trace_v2(db, 0, nullptr, nullptr); res != SQLITE_OK)
+            throw SqliteError(std::format("Failed to clear slow query log."), res, SQLITE_OK);
+        slowQueryLog.reset();
+    }
+
+    void Database::setCheckpointer(const CheckpointPolicy& policy)
+    {
+        // Destroy old checkpointer first, so that the new one sees the original wal_autocheckpoint value.
+        checkpointer.reset();
+        checkpointer = std::make_unique<Checkpointer>(*this, policy);
+    }
+
+    void Database::clearCheckpointer() { checkpointer.reset(); }
+
     ////////////////////////////////////////////////////////////////
     // ...
     ////////////////////////////////////////////////////////////////
 
+    void Database::interrupt() noexcept { sqlite3_interrupt(db); }
+
+    int64_t Database::releaseMemory()
+    {
+        const auto before = getDbStatus(db, SQLITE_DBSTATUS_CACHE_USED);
+        if (const auto res = sqlite3_db_release_memory(db); res != SQLITE_OK)
+            throw SqliteError(std::format("Failed to release memory."), res, SQLITE_OK);
+        return before - getDbStatus(db, SQLITE_DBSTATUS_CACHE_USED);
+    }
+
+    bool Database::checkMemoryBudget()
+    {
+        if (!memoryBudget) return false;
+
+        const auto usage     = getMemoryUsage();
+        const bool overCache = memoryBudget->cacheBytes > 0 && usage.cacheUsed > memoryBudget->cacheBytes;
+        const bool overStmt  = memoryBudget->statementBytes > 0 && usage.statementUsed > memoryBudget->statementBytes;
+        if (!overCache && !overStmt) return false;
+
+        if (memoryBudget->callback)
+        {
+            // Copy, in case the callback replaces the budget.
+            const auto callback = memoryBudget->callback;
+            callback(*this, usage);
+        }
+        else
+        {
+            if (overStmt) statementCache.clear();
+            static_cast<void>(releaseMemory());
+        }
+
+        return true;
+    }
+
     Statement Database::createStatement(std::string code, const bool prepare)
     {
         return {*this, std::move(code), prepare};
@@ -143,7 +557,11 @@ namespace sql
     Table& Database::createTable(const std::string& name)
     {
         // Create new table.
-        const auto [it, created] = tables.try_emplace(name, std::make_unique<Table>(this, name));
+        if (unloadedTables.contains(name))
+            throw CppqlError(std::format("Could not create table {}. A table with this name already exists.", name));
+        auto [schema, tableName] = splitTableName(name);
+        const auto [it, created] =
+          tables.try_emplace(name, std::make_unique<Table>(this, std::move(schema), std::move(tableName)));
         if (!created)
             throw CppqlError(std::format("Could not create table {}. A table with this name already exists.", name));
         return *it->second;
@@ -154,12 +572,16 @@ namespace sql
         if (tables.contains(name))
             throw CppqlError(
               std::format("Could not register table {}. A table with this name was already registered.", name));
+        if (unloadedTables.contains(name)) return loadTable(name);
 
         // Map to keep track of foreign key constraints.
         std::unordered_map<std::string, std::vector<std::tuple<std::string, std::string, std::string>>> foreignKeys;
 
         // Create table.
-        const auto& table = tables.try_emplace(name, std::make_unique<Table>(this, name)).first->second;
+        auto [schema, tableName] = splitTableName(name);
+        const auto& table =
+          tables.try_emplace(name, std::make_unique<Table>(this, std::move(schema), std::move(tableName)))
+            .first->second;
 
         // Read table definition from database and collect foreign keys.
         table->readFromDb(foreignKeys);
@@ -172,7 +594,7 @@ namespace sql
 
     void Database::dropTable(const std::string& name)
     {
-        if (!tables.contains(name))
+        if (!tables.contains(name) && !unloadedTables.contains(name))
             throw CppqlError(std::format("Could not drop table {}. A table with this name does not exist.", name));
 
         // Execute drop table statement.
@@ -182,9 +604,69 @@ namespace sql
 
         // Erase table object from map.
         tables.erase(name);
+        unloadedTables.erase(name);
+    }
+
+    void Database::attach(const std::filesystem::path& file, const std::string& alias)
+    {
+        // The alias is formatted into queries on the schema of the attached database, so only allow identifiers.
+        const auto isIdentifierChar = [](const char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+        if (alias.empty() || std::isdigit(static_cast<unsigned char>(alias.front())) ||
+            !std::ranges::all_of(alias, isIdentifierChar))
+            throw CppqlError(std::format("Could not attach database as {}. Alias must be an identifier.", alias));
+        if (attachedSchemas.contains(alias))
+            throw CppqlError(std::format("Could not attach database as {}. Alias is already in use.", alias));
+
+        const auto stmt = createStatement(std::format("ATTACH DATABASE ? AS {};", alias), true);
+        if (!stmt.isPrepared())
+            throw SqliteError(std::format("Failed to prepare statement \"{}\".", stmt.getSql()),
+                              stmt.getResult()->code,
+                              stmt.getResult()->extendedCode);
+
+        if (const auto res = stmt.bindTransientText(Statement::getFirstBindIndex(), file.string()); !res)
+            throw SqliteError(std::format("Failed to bind path {}.", file.string()), res.code, res.extendedCode);
+
+        if (const auto res = stmt.step(); !res)
+            throw SqliteError(
+              std::format("Failed to attach database {} as {}.", file.string(), alias), res.code, res.extendedCode);
+
+        attachedSchemas.emplace(alias);
+        try
+        {
+            initializeTables(alias);
+        }
+        catch (...)
+        {
+            detach(alias);
+            throw;
+        }
+    }
+
+    void Database::detach(const std::string& alias)
+    {
+        if (!attachedSchemas.contains(alias))
+            throw CppqlError(std::format("Could not detach database {}. No database is attached as {}.", alias, alias));
+
+        // Statements on the attached database keep it in use.
+        statementCache.clear();
+
+        const auto stmt = createStatement(std::format("DETACH DATABASE {};", alias), true);
+        if (const auto res = stmt.step(); !res)
+            throw SqliteError(std::format("Failed to detach database {}.", alias), res.code, res.extendedCode);
+
+        attachedSchemas.erase(alias);
+        std::erase_if(tables, [&](const auto& table) { return table.second->getSchema() == alias; });
+        std::erase_if(unloadedTables, [&](const auto& name) { return name.starts_with(alias + "."); });
     }
 
-    Transaction Database::beginTransaction(const Transaction::Type type) { return Transaction(*this, type); }
+    Transaction Database::beginTransaction(const Transaction::Type type, const size_t retries)
+    {
+        return Transaction(*this, type, retries);
+    }
+
+    Transaction Database::beginTransaction(const Snapshot& snapshot) { return Transaction(*this, snapshot); }
+
+    Savepoint Database::beginSavepoint() { return Savepoint(*this); }
 
     void Database::vacuum()
     {
@@ -193,35 +675,344 @@ namespace sql
             throw SqliteError(std::format("Failed to VACUUM database."), res.code, res.extendedCode);
     }
 
-    void Database::initializeTables()
+    void Database::vacuumInto(const std::filesystem::path& file)
+    {
+        const auto stmt = createStatement("VACUUM INTO ?;", true);
+        if (!stmt.isPrepared())
+            throw SqliteError(std::format("Failed to prepare statement \"{}\".", stmt.getSql()),
+                              stmt.getResult()->code,
+                              stmt.getResult()->extendedCode);
+
+        if (const auto res = stmt.bindTransientText(Statement::getFirstBindIndex(), file.string()); !res)
+            throw SqliteError(std::format("Failed to bind path {}.", file.string()), res.code, res.extendedCode);
+
+        if (const auto res = stmt.step(); !res)
+            throw SqliteError(
+              std::format("Failed to VACUUM database into {}.", file.string()), res.code, res.extendedCode);
+    }
+
+    int64_t Database::incrementalVacuum(const int64_t maxPages)
+    {
+        const auto before = getFreePageCount();
+
+        const auto stmt = createStatement(std::format("PRAGMA incremental_vacuum({});", maxPages), true);
+        if (!stmt.isPrepared())
+            throw SqliteError(std::format("Failed to prepare statement \"{}\".", stmt.getSql()),
+                              stmt.getResult()->code,
+                              stmt.getResult()->extendedCode);
+
+        auto res = stmt.step();
+        while (res.code == SQLITE_ROW) res = stmt.step();
+        if (!res) throw SqliteError("Failed to run incremental vacuum.", res.code, res.extendedCode);
+
+        return before - getFreePageCount();
+    }
+
+    QueryPlan Database::explain(const std::string& code)
+    {
+        const auto stmt = createStatement(std::format("EXPLAIN QUERY PLAN {}", code), true);
+        if (!stmt.isPrepared())
+            throw SqliteError(std::format("Failed to prepare statement \"{}\".", stmt.getSql()),
+                              stmt.getResult()->code,
+                              stmt.getResult()->extendedCode);
+
+        // Columns are id, parent, notused and detail.
+        std::vector<QueryPlanNode> rows;
+        auto                       res = stmt.step();
+        while (res.code == SQLITE_ROW)
+        {
+            rows.emplace_back(stmt.column<int32_t>(0), stmt.column<int32_t>(1), stmt.column<std::string>(3));
+            res = stmt.step();
+        }
+        if (!res) throw SqliteError(std::format("Failed to explain \"{}\".", code), res.code, res.extendedCode);
+
+        return QueryPlan(rows);
+    }
+
+    void Database::setPragma(const std::string& name, const std::string& value)
+    {
+        const auto stmt = createStatement(std::format("PRAGMA {}={};", name, value), true);
+        if (!stmt.isPrepared())
+            throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt.getSql()),
+                              stmt.getResult()->code,
+                              stmt.getResult()->extendedCode);
+        if (const auto res = stmt.step(); !res)
+            throw SqliteError(std::format("Failed to set PRAGMA {}.", name), res.code, res.extendedCode);
+    }
+
+    template<typename T>
+    std::optional<T> Database::getPragma(const std::string& name)
+    {
+        const auto stmt = createStatement(std::format("PRAGMA {};", name), true);
+        if (!stmt.isPrepared())
+            throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt.getSql()),
+                              stmt.getResult()->code,
+                              stmt.getResult()->extendedCode);
+        const auto res = stmt.step();
+        if (!res) throw SqliteError(std::format("Failed to get PRAGMA {}.", name), res.code, res.extendedCode);
+
+        // PRAGMAs that are not supported by this build of sqlite do not return a row.
+        if (res.code != SQLITE_ROW) return std::nullopt;
+        return stmt.column<T>(0);
+    }
+
+    Result Database::runPersistent(const std::string& code)
+    {
+        auto it = persistentStatements.find(code);
+        if (it == persistentStatements.end())
+        {
+            auto stmt = std::make_unique<Statement>(*this, code, true);
+            if (!stmt->isPrepared())
+                throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt->getSql()),
+                                  stmt->getResult()->code,
+                                  stmt->getResult()->extendedCode);
+            it = persistentStatements.emplace(code, std::move(stmt)).first;
+        }
+
+        const auto res = it->second->step();
+        static_cast<void>(it->second->reset());
+        return res;
+    }
+
+    void Database::countStatementReset() noexcept
+    {
+        if (!memoryBudget || --budgetCountdown > 0) return;
+
+        budgetCountdown = memoryBudget->checkInterval;
+        try
+        {
+            static_cast<void>(checkMemoryBudget());
+        }
+        catch (...)
+        {
+            // Called when a statement is reset, which must not fail because of the budget.
+        }
+    }
+
+    void Database::pushCancellationScope(const CancellationScope& scope)
+    {
+        if (!progressHandler) progressHandler = std::make_unique<ProgressHandler>();
+        progressHandler->pushScope(scope);
+        updateProgressHandler();
+    }
+
+    void Database::popCancellationScope(const CancellationScope& scope) noexcept
+    {
+        progressHandler->popScope(scope);
+        updateProgressHandler();
+    }
+
+    void Database::updateProgressHandler() noexcept
     {
+        if (progressHandler->isActive())
+            sqlite3_progress_handler(
+              db, progressHandler->getInstructions(), &ProgressHandler::callback, progressHandler.get());
+        else
+            sqlite3_progress_handler(db, 0, nullptr, nullptr);
+    }
+
+    std::optional<InterruptReason> Database::checkCancellation() const noexcept
+    {
+        return progressHandler ? progressHandler->checkScopes() : std::nullopt;
+    }
+
+    InterruptReason Database::takeInterruptReason() noexcept
+    {
+        return progressHandler ? progressHandler->takeReason() : InterruptReason::Interrupt;
+    }
+
+    const std::array<std::string, 3>& Database::getSavepointCode(const size_t depth)
+    {
+        while (savepointCode.size() <= depth)
+        {
+            const auto name = std::format("cppql_savepoint_{}", savepointCode.size());
+            savepointCode.push_back({std::format("SAVEPOINT {};", name),
+                                     std::format("RELEASE {};", name),
+                                     std::format("ROLLBACK TO {};", name)});
+        }
+
+        return savepointCode[depth];
+    }
+
+    void Database::backupTo(const std::filesystem::path& file, const BackupOptions& options)
+    {
+        sqlite3* destination = nullptr;
+        if (const auto res = sqlite3_open_v2(
+              file.string().c_str(), &destination, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr);
+            res != SQLITE_OK)
+        {
+            sqlite3_close_v2(destination);
+            throw SqliteError(std::format("Failed to open backup destination {}.", file.string()), res, SQLITE_OK);
+        }
+
+        try
+        {
+            backup(destination, db, options);
+        }
+        catch (...)
+        {
+            sqlite3_close_v2(destination);
+            throw;
+        }
+
+        sqlite3_close_v2(destination);
+    }
+
+    void Database::backupTo(Database& destination, const BackupOptions& options)
+    {
+        if (&destination == this) throw CppqlError("Cannot backup a database into itself.");
+
+        backup(destination.db, db, options);
+
+        // Reread schema of destination. Only the main database was overwritten.
+        std::erase_if(destination.tables, [](const auto& table) { return table.second->getSchema().empty(); });
+        std::erase_if(destination.unloadedTables,
+                      [&](const auto& name) { return destination.splitTableName(name).first.empty(); });
+        destination.initializeTables();
+    }
+
+    std::vector<std::byte> Database::serialize() const
+    {
+        sqlite3_int64 size = 0;
+        auto*         data = sqlite3_serialize(db, "main", &size, 0);
+
+        // An empty database has no pages to allocate.
+        if (!data && size == 0) return {};
+        if (!data)
+            throw SqliteError(
+              std::format("Failed to serialize database."), sqlite3_errcode(db), sqlite3_extended_errcode(db));
+
+        const auto* bytes = reinterpret_cast<const std::byte*>(data);
+        auto        res   = std::vector<std::byte>(bytes, bytes + size);
+        sqlite3_free(data);
+        return res;
+    }
+
+    std::span<const std::byte> Database::serializeNoCopy() const noexcept
+    {
+        sqlite3_int64 size = 0;
+        const auto*   data = sqlite3_serialize(db, "main", &size, SQLITE_SERIALIZE_NOCOPY);
+        if (!data) return {};
+        return {reinterpret_cast<const std::byte*>(data), static_cast<size_t>(size)};
+    }
+
+    void Database::initializeTables(const std::string& schema)
+    {
+        // Attached database aliases are identifiers, so they can be formatted into the queries.
+        const std::string schemaName = schema.empty() ? "main" : schema;
+
+        if (schemaLoading == SchemaLoading::Lazy)
+        {
+            const auto selectNames =
+              createStatement(std::format("SELECT name FROM {}.sqlite_master WHERE type='table';", schemaName), true);
+            while (selectNames.step().code == SQLITE_ROW)
+            {
+                // Skip sqlite tables.
+                if (auto name = selectNames.column<std::string>(0); !name.starts_with("sqlite_"))
+                    unloadedTables.emplace(Table::qualify(schema, name));
+            }
+            return;
+        }
+
         // Map to keep track of foreign key constraints. These are resolved after all tables and their columns have been created.
         std::unordered_map<std::string, std::vector<std::tuple<std::string, std::string, std::string>>> foreignKeys;
 
-        const auto selectSchema = createStatement("SELECT name, sql FROM sqlite_master WHERE type='table';", true);
-        auto       res          = selectSchema.step();
+        // Read the columns of all tables in a single query.
+        const auto selectColumns = createStatement(
+          std::format("SELECT m.name, c.name, c.type, c.\"notnull\", c.pk FROM {0}.sqlite_master AS m JOIN "
+                      "pragma_table_xinfo(m.name, '{0}') AS c WHERE m.type='table' AND c.hidden != 1 ORDER BY m.name, "
+                      "c.cid;",
+                      schemaName),
+          true);
+        if (!selectColumns.isPrepared())
+            throw SqliteError(std::format("Failed to prepare statement \"{}\"", selectColumns.getSql()),
+                              selectColumns.getResult()->code,
+                              selectColumns.getResult()->extendedCode);
+
+        auto res = selectColumns.step();
         while (res.code == SQLITE_ROW)
         {
             // Get table name.
-            const auto name = selectSchema.column<std::string>(0);
+            const auto name = selectColumns.column<std::string>(0);
 
             // Skip sqlite tables.
             if (name.starts_with("sqlite_"))
             {
-                res = selectSchema.step();
+                res = selectColumns.step();
                 continue;
             }
 
-            // Create table.
-            const auto& table = tables.try_emplace(name, std::make_unique<Table>(this, name)).first->second;
+            // Get or create table and add column.
+            const auto& table =
+              tables.try_emplace(Table::qualify(schema, name), std::make_unique<Table>(this, schema, name))
+                .first->second;
+            table->readColumn(selectColumns.column<std::string>(1),
+                              selectColumns.column<std::string>(2),
+                              selectColumns.column<int32_t>(3) != 0,
+                              selectColumns.column<int32_t>(4) != 0);
 
-            // Read table definition from database and collect foreign keys.
-            table->readFromDb(foreignKeys);
+            res = selectColumns.step();
+        }
+        if (!res) throw SqliteError(std::format("Failed to read database schema."), res.code, res.extendedCode);
+
+        // Collect foreign keys of all tables. Foreign keys always reference a table in the same database.
+        const auto selectForeignKeys =
+          createStatement(std::format("SELECT m.name, f.\"table\", f.\"from\", f.\"to\" FROM {0}.sqlite_master AS m "
+                                      "JOIN pragma_foreign_key_list(m.name, '{0}') AS f WHERE m.type='table';",
+                                      schemaName),
+                          true);
+        while (selectForeignKeys.step().code == SQLITE_ROW)
+        {
+            auto& tableForeignKeys = foreignKeys[Table::qualify(schema, selectForeignKeys.column<std::string>(0))];
+            tableForeignKeys.emplace_back(Table::qualify(schema, selectForeignKeys.column<std::string>(1)),
+                                          selectForeignKeys.column<std::string>(2),
+                                          selectForeignKeys.column<std::string>(3));
+        }
 
-            res = selectSchema.step();
+        // Resolve foreign keys.
+        for (auto& [name, table] : tables)
+        {
+            if (table->getSchema() == schema) table->resolveForeignKeys(foreignKeys, tables);
+        }
+    }
+
+    std::pair<std::string, std::string> Database::splitTableName(const std::string& name) const
+    {
+        if (const auto pos = name.find('.'); pos != std::string::npos)
+        {
+            if (auto schema = name.substr(0, pos); attachedSchemas.contains(schema))
+                return {std::move(schema), name.substr(pos + 1)};
+        }
+
+        return {std::string{}, name};
+    }
+
+    Table& Database::loadTable(const std::string& name)
+    {
+        // Map to keep track of foreign key constraints.
+        std::unordered_map<std::string, std::vector<std::tuple<std::string, std::string, std::string>>> foreignKeys;
+
+        // Create table. Removing the name from the unloaded tables first prevents infinite recursion on cyclic
+        // foreign keys.
+        unloadedTables.erase(name);
+        auto [schema, tableName] = splitTableName(name);
+        auto& table =
+          *tables.try_emplace(name, std::make_unique<Table>(this, std::move(schema), std::move(tableName)))
+             .first->second;
+
+        // Read table definition from database and collect foreign keys.
+        table.readFromDb(foreignKeys);
+
+        // Referenced tables must be loaded before foreign keys can be resolved.
+        if (const auto it = foreignKeys.find(name); it != foreignKeys.end())
+        {
+            for (const auto& fk : it->second)
+                if (unloadedTables.contains(std::get<0>(fk))) loadTable(std::get<0>(fk));
         }
 
         // Resolve foreign keys.
-        for (auto& [name, table] : tables) { table->resolveForeignKeys(foreignKeys, tables); }
+        table.resolveForeignKeys(foreignKeys, tables);
+
+        return table;
     }
 }  // namespace sql
\ No newline at end of file
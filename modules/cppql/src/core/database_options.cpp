@@ -0,0 +1,121 @@
+#include "cppql/core/database_options.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <cctype>
+#include <format>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/cppql_error.h"
+
+namespace sql
+{
+    namespace
+    {
+        /**
+         * \brief PRAGMA statements return modes in lower case.
+         */
+        std::string toUpper(std::string s)
+        {
+            std::ranges::transform(s, s.begin(), [](const unsigned char c) { return std::toupper(c); });
+            return s;
+        }
+    }  // namespace
+
+    std::string toString(const JournalMode value)
+    {
+        switch (value)
+        {
+        case JournalMode::Delete: return "DELETE";
+        case JournalMode::Truncate: return "TRUNCATE";
+        case JournalMode::Persist: return "PERSIST";
+        case JournalMode::Memory: return "MEMORY";
+        case JournalMode::Wal: return "WAL";
+        case JournalMode::Off: return "OFF";
+        }
+
+        return "";
+    }
+
+    std::string toString(const Synchronous value)
+    {
+        switch (value)
+        {
+        case Synchronous::Off: return "OFF";
+        case Synchronous::Normal: return "NORMAL";
+        case Synchronous::Full: return "FULL";
+        case Synchronous::Extra: return "EXTRA";
+        }
+
+        return "";
+    }
+
+    std::string toString(const TempStore value)
+    {
+        switch (value)
+        {
+        case TempStore::Default: return "DEFAULT";
+        case TempStore::File: return "FILE";
+        case TempStore::Memory: return "MEMORY";
+        }
+
+        return "";
+    }
+
+    std::string toString(const LockingMode value)
+    {
+        switch (value)
+        {
+        case LockingMode::Normal: return "NORMAL";
+        case LockingMode::Exclusive: return "EXCLUSIVE";
+        }
+
+        return "";
+    }
+
+    std::string toString(const AutoVacuum value)
+    {
+        switch (value)
+        {
+        case AutoVacuum::None: return "NONE";
+        case AutoVacuum::Full: return "FULL";
+        case AutoVacuum::Incremental: return "INCREMENTAL";
+        }
+
+        return "";
+    }
+
+    void fromString(const std::string& s, JournalMode& value)
+    {
+        if (const auto upper = toUpper(s); upper == "DELETE")
+            value = JournalMode::Delete;
+        else if (upper == "TRUNCATE")
+            value = JournalMode::Truncate;
+        else if (upper == "PERSIST")
+            value = JournalMode::Persist;
+        else if (upper == "MEMORY")
+            value = JournalMode::Memory;
+        else if (upper == "WAL")
+            value = JournalMode::Wal;
+        else if (upper == "OFF")
+            value = JournalMode::Off;
+        else
+            throw CppqlError(std::format("Unknown journal mode {}", s));
+    }
+
+    void fromString(const std::string& s, LockingMode& value)
+    {
+        if (const auto upper = toUpper(s); upper == "NORMAL")
+            value = LockingMode::Normal;
+        else if (upper == "EXCLUSIVE")
+            value = LockingMode::Exclusive;
+        else
+            throw CppqlError(std::format("Unknown locking mode {}", s));
+    }
+}  // namespace sql
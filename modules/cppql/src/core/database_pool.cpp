@@ -0,0 +1,184 @@
+#include "cppql/core/database_pool.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <format>
+#include <utility>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/cppql_error.h"
+#include "cppql/error/sqlite_error.h"
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // Lease.
+    ////////////////////////////////////////////////////////////////
+
+    DatabasePool::Lease::Lease(DatabasePool& p, Database& database, const size_t idx) :
+        pool(&p), db(&database), index(idx)
+    {
+    }
+
+    DatabasePool::Lease::Lease(Lease&& other) noexcept :
+        pool(std::exchange(other.pool, nullptr)), db(std::exchange(other.db, nullptr)), index(other.index)
+    {
+    }
+
+    DatabasePool::Lease::~Lease() noexcept { release(); }
+
+    DatabasePool::Lease& DatabasePool::Lease::operator=(Lease&& other) noexcept
+    {
+        if (this != &other)
+        {
+            release();
+            pool  = std::exchange(other.pool, nullptr);
+            db    = std::exchange(other.db, nullptr);
+            index = other.index;
+        }
+        return *this;
+    }
+
+    Database& DatabasePool::Lease::get() const noexcept { return *db; }
+
+    Database& DatabasePool::Lease::operator*() const noexcept { return *db; }
+
+    Database* DatabasePool::Lease::operator->() const noexcept { return db; }
+
+    bool DatabasePool::Lease::isWriter() const noexcept { return index == writer_index; }
+
+    void DatabasePool::Lease::release() noexcept
+    {
+        if (!pool) return;
+        pool->release(index);
+        pool = nullptr;
+        db   = nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // DatabasePool.
+    ////////////////////////////////////////////////////////////////
+
+    DatabasePool::DatabasePool(const std::filesystem::path& file, const size_t readerCount, const int32_t flags)
+    {
+        if (flags & SQLITE_OPEN_MEMORY)
+            throw CppqlError("Cannot create a database pool for an in-memory database.");
+
+        // Open writer connection.
+        writerDb = Database::openOrCreate(file, flags).first;
+
+        // Enable WAL mode. This is persistent, so readers opened afterwards will use it as well.
+        {
+            const auto stmt = writerDb->createStatement("PRAGMA journal_mode=WAL;", true);
+            if (!stmt.isPrepared())
+                throw SqliteError(std::format("Failed to prepare statement \"{}\"", stmt.getSql()),
+                                  stmt.getResult()->code,
+                                  stmt.getResult()->extendedCode);
+            if (const auto res = stmt.step(); !res)
+                throw SqliteError(std::format("Failed to enable WAL mode."), res.code, res.extendedCode);
+            if (const auto mode = stmt.column<std::string>(0); mode != "wal")
+                throw CppqlError(std::format("Failed to enable WAL mode. Journal mode is {}.", mode));
+        }
+
+        // Open reader connections.
+        readers.reserve(readerCount);
+        available.reserve(readerCount);
+        for (size_t i = 0; i < readerCount; i++)
+        {
+            sqlite3* db = nullptr;
+            if (const auto res = sqlite3_open_v2(file.string().c_str(), &db, SQLITE_OPEN_READONLY | flags, nullptr);
+                res != SQLITE_OK)
+            {
+                sqlite3_close_v2(db);
+                throw SqliteError(
+                  std::format("Failed to open reader connection to {}.", file.string()), res, SQLITE_OK);
+            }
+
+            // Only the writer, which is destroyed last, is allowed to shut down sqlite.
+            auto& reader = readers.emplace_back(std::make_unique<Database>(db));
+            reader->setShutdown(Database::Shutdown::Off);
+            available.push_back(i);
+        }
+    }
+
+    DatabasePool::~DatabasePool() noexcept = default;
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    size_t DatabasePool::getReaderCount() const noexcept { return readers.size(); }
+
+    size_t DatabasePool::getAvailableReaderCount() const
+    {
+        std::scoped_lock lock(mutex);
+        return available.size();
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Leases.
+    ////////////////////////////////////////////////////////////////
+
+    DatabasePool::Lease DatabasePool::writer()
+    {
+        std::unique_lock lock(mutex);
+        writerCondition.wait(lock, [this] { return !writerLeased; });
+        writerLeased = true;
+        return {*this, *writerDb, writer_index};
+    }
+
+    std::optional<DatabasePool::Lease> DatabasePool::tryWriter()
+    {
+        std::scoped_lock lock(mutex);
+        if (writerLeased) return std::nullopt;
+        writerLeased = true;
+        return Lease(*this, *writerDb, writer_index);
+    }
+
+    DatabasePool::Lease DatabasePool::reader()
+    {
+        if (readers.empty()) throw CppqlError("Cannot lease a reader from a database pool without readers.");
+
+        std::unique_lock lock(mutex);
+        readerCondition.wait(lock, [this] { return !available.empty(); });
+        const auto index = available.back();
+        available.pop_back();
+        return {*this, *readers[index], index};
+    }
+
+    std::optional<DatabasePool::Lease> DatabasePool::tryReader()
+    {
+        std::scoped_lock lock(mutex);
+        if (available.empty()) return std::nullopt;
+        const auto index = available.back();
+        available.pop_back();
+        return Lease(*this, *readers[index], index);
+    }
+
+    void DatabasePool::release(const size_t index) noexcept
+    {
+        {
+            std::scoped_lock lock(mutex);
+            if (index == writer_index)
+                writerLeased = false;
+            else
+                available.push_back(index);
+        }
+
+        if (index == writer_index)
+            writerCondition.notify_one();
+        else
+            readerCondition.notify_one();
+    }
+}  // namespace sql
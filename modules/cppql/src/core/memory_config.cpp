@@ -0,0 +1,313 @@
+#include "cppql/core/memory_config.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <format>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <utility>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/cppql_error.h"
+#include "cppql/error/sqlite_error.h"
+
+namespace sql
+{
+    namespace
+    {
+        /**
+         * \brief Arenas handed to sqlite. Only replaced while sqlite is not initialized, so they are never in use
+         * when they are freed.
+         */
+        std::unique_ptr<std::byte[]> page_cache_arena;
+        std::unique_ptr<std::byte[]> heap_arena;
+
+#ifndef CPPQL_ENABLE_MEMSYS5
+        /**
+         * \brief Allocator that serves all allocations of sqlite from the heap arena. Each block is a power of two in
+         * size and starts with a header holding its size class. New blocks are carved from the front of the arena.
+         * Freed blocks are put on a free list per size class and reused by later allocations of that class.
+         *
+         * sqlite only passes its application data to xInit and xShutdown, so there is a single global instance.
+         * sqlite does not serialize calls to the allocator when memory statistics are disabled, hence the mutex.
+         */
+        class ArenaAllocator
+        {
+        public:
+            /**
+             * \brief Bytes in front of each block, holding its size class. Keeps blocks 8 byte aligned, as required
+             * by sqlite.
+             */
+            static constexpr size_t header_size = 8;
+
+            /**
+             * \brief Smallest size class. Blocks must have room for the header and the free list pointer.
+             */
+            static constexpr uint64_t min_class = 4;
+
+            void assign(std::byte* data, const size_t size, const int32_t minAllocation)
+            {
+                std::scoped_lock lock(mutex);
+                begin    = data;
+                end      = data + size;
+                top      = data;
+                minClass = std::max<uint64_t>(
+                  min_class, std::bit_width(static_cast<uint64_t>(std::max<int32_t>(minAllocation, 1)) - 1));
+                freeLists.fill(nullptr);
+            }
+
+            [[nodiscard]] uint64_t sizeClass(const int32_t n) const noexcept
+            {
+                const auto bytes = static_cast<uint64_t>(std::max<int32_t>(n, 0)) + header_size;
+                return std::max(minClass, static_cast<uint64_t>(std::bit_width(bytes - 1)));
+            }
+
+            void* allocate(const int32_t n)
+            {
+                const auto       cls = sizeClass(n);
+                std::scoped_lock lock(mutex);
+
+                std::byte* block = nullptr;
+                if (freeLists[cls])
+                {
+                    block = freeLists[cls];
+                    std::memcpy(&freeLists[cls], block + header_size, sizeof(std::byte*));
+                }
+                else if (static_cast<size_t>(end - top) >= uint64_t{1} << cls)
+                {
+                    block = top;
+                    top += uint64_t{1} << cls;
+                    std::memcpy(block, &cls, sizeof(cls));
+                }
+                else
+                    return nullptr;
+
+                return block + header_size;
+            }
+
+            void release(void* p)
+            {
+                if (!p) return;
+                auto* const block = static_cast<std::byte*>(p) - header_size;
+                const auto  cls   = classOf(p);
+
+                std::scoped_lock lock(mutex);
+                std::memcpy(block + header_size, &freeLists[cls], sizeof(std::byte*));
+                freeLists[cls] = block;
+            }
+
+            [[nodiscard]] static uint64_t classOf(const void* p) noexcept
+            {
+                uint64_t cls = 0;
+                std::memcpy(&cls, static_cast<const std::byte*>(p) - header_size, sizeof(cls));
+                return cls;
+            }
+
+            [[nodiscard]] static int32_t usable(const uint64_t cls) noexcept
+            {
+                return static_cast<int32_t>((uint64_t{1} << cls) - header_size);
+            }
+
+            void reset()
+            {
+                std::scoped_lock lock(mutex);
+                top = begin;
+                freeLists.fill(nullptr);
+            }
+
+            static void* xMalloc(int32_t n);
+
+            static void xFree(void* p);
+
+            static void* xRealloc(void* p, int32_t n);
+
+            static int32_t xSize(void* p);
+
+            static int32_t xRoundup(int32_t n);
+
+            static int32_t xInit(void*);
+
+            static void xShutdown(void*);
+
+        private:
+            std::mutex mutex;
+
+            std::byte* begin = nullptr;
+
+            std::byte* end = nullptr;
+
+            /**
+             * \brief Start of the unused part of the arena.
+             */
+            std::byte* top = nullptr;
+
+            uint64_t minClass = min_class;
+
+            /**
+             * \brief Head of the free list of each size class. The next block is stored after the header.
+             */
+            std::array<std::byte*, 64> freeLists{};
+        };
+
+        ArenaAllocator arena_allocator;
+
+        void* ArenaAllocator::xMalloc(const int32_t n) { return arena_allocator.allocate(n); }
+
+        void ArenaAllocator::xFree(void* p) { arena_allocator.release(p); }
+
+        void* ArenaAllocator::xRealloc(void* p, const int32_t n)
+        {
+            // Block is already large enough.
+            const auto cls = classOf(p);
+            if (arena_allocator.sizeClass(n) == cls) return p;
+
+            void* q = arena_allocator.allocate(n);
+            if (!q) return nullptr;
+            std::memcpy(q, p, static_cast<size_t>(std::min(usable(cls), n)));
+            arena_allocator.release(p);
+            return q;
+        }
+
+        int32_t ArenaAllocator::xSize(void* p) { return p ? usable(classOf(p)) : 0; }
+
+        int32_t ArenaAllocator::xRoundup(const int32_t n) { return usable(arena_allocator.sizeClass(n)); }
+
+        int32_t ArenaAllocator::xInit(void*)
+        {
+            // Nothing allocated before a shutdown is in use anymore.
+            arena_allocator.reset();
+            return SQLITE_OK;
+        }
+
+        void ArenaAllocator::xShutdown(void*) {}
+
+        constexpr sqlite3_mem_methods arena_methods = {.xMalloc   = &ArenaAllocator::xMalloc,
+                                                       .xFree     = &ArenaAllocator::xFree,
+                                                       .xRealloc  = &ArenaAllocator::xRealloc,
+                                                       .xSize     = &ArenaAllocator::xSize,
+                                                       .xRoundup  = &ArenaAllocator::xRoundup,
+                                                       .xInit     = &ArenaAllocator::xInit,
+                                                       .xShutdown = &ArenaAllocator::xShutdown,
+                                                       .pAppData  = nullptr};
+
+        /**
+         * \brief Allocator that was installed before the arena allocator, restored when the heap arena is removed.
+         */
+        std::optional<sqlite3_mem_methods> previous_methods;
+#endif
+
+        void check(const int32_t res, const char* option)
+        {
+            if (res == SQLITE_MISUSE)
+                throw SqliteError(
+                  std::format("Failed to configure {}. sqlite must not be initialized yet.", option), res, SQLITE_OK);
+            if (res != SQLITE_OK) throw SqliteError(std::format("Failed to configure {}.", option), res, SQLITE_OK);
+        }
+    }  // namespace
+
+    void configureMemory(const MemoryConfig& config)
+    {
+        if (config.memoryStatus)
+            check(sqlite3_config(SQLITE_CONFIG_MEMSTATUS, *config.memoryStatus ? 1 : 0), "MEMSTATUS");
+
+        if (config.heap)
+        {
+            std::unique_ptr<std::byte[]> arena;
+            if (config.heap->size > 0) arena = std::make_unique<std::byte[]>(config.heap->size);
+#ifdef CPPQL_ENABLE_MEMSYS5
+            check(sqlite3_config(SQLITE_CONFIG_HEAP,
+                                 arena.get(),
+                                 static_cast<int32_t>(config.heap->size),
+                                 config.heap->minAllocation),
+                  "HEAP");
+#else
+            sqlite3_mem_methods current{};
+            check(sqlite3_config(SQLITE_CONFIG_GETMALLOC, &current), "HEAP");
+            const bool installed = current.xMalloc == arena_methods.xMalloc;
+
+            if (arena)
+            {
+                check(sqlite3_config(SQLITE_CONFIG_MALLOC, &arena_methods), "HEAP");
+                if (!installed) previous_methods = current;
+                arena_allocator.assign(arena.get(), config.heap->size, config.heap->minAllocation);
+            }
+            else if (installed)
+            {
+                check(sqlite3_config(SQLITE_CONFIG_MALLOC, &*previous_methods), "HEAP");
+                arena_allocator.assign(nullptr, 0, 0);
+            }
+#endif
+            heap_arena = std::move(arena);
+        }
+        else if (config.allocator)
+            check(sqlite3_config(SQLITE_CONFIG_MALLOC, config.allocator), "MALLOC");
+
+        if (config.pageCache)
+        {
+            int32_t headerSize = 0;
+            check(sqlite3_config(SQLITE_CONFIG_PCACHE_HDRSZ, &headerSize), "PCACHE_HDRSZ");
+
+            const auto                   slotSize = config.pageCache->pageSize + headerSize;
+            const auto                   pages    = config.pageCache->pages;
+            std::unique_ptr<std::byte[]> arena;
+            if (pages > 0) arena = std::make_unique<std::byte[]>(static_cast<size_t>(slotSize) * pages);
+            check(sqlite3_config(SQLITE_CONFIG_PAGECACHE, arena.get(), arena ? slotSize : 0, arena ? pages : 0),
+                  "PAGECACHE");
+            page_cache_arena = std::move(arena);
+        }
+
+        if (config.lookaside)
+            check(sqlite3_config(SQLITE_CONFIG_LOOKASIDE, config.lookaside->slotSize, config.lookaside->slots),
+                  "LOOKASIDE");
+    }
+
+    MemoryStats getMemoryStats(const bool reset)
+    {
+        const auto get = [reset](const int32_t op) {
+            sqlite3_int64 current = 0, highwater = 0;
+            if (const auto res = sqlite3_status64(op, &current, &highwater, reset ? 1 : 0); res != SQLITE_OK)
+                throw SqliteError(std::format("Failed to get memory status {}.", op), res, SQLITE_OK);
+            return std::make_pair(static_cast<int64_t>(current), static_cast<int64_t>(highwater));
+        };
+
+        MemoryStats stats;
+        std::tie(stats.memoryUsed, stats.memoryHighwater) = get(SQLITE_STATUS_MEMORY_USED);
+        stats.mallocCount                                 = get(SQLITE_STATUS_MALLOC_COUNT).first;
+        stats.largestAllocation                           = get(SQLITE_STATUS_MALLOC_SIZE).second;
+        stats.pageCacheUsed                               = get(SQLITE_STATUS_PAGECACHE_USED).first;
+        stats.pageCacheOverflow                           = get(SQLITE_STATUS_PAGECACHE_OVERFLOW).first;
+        return stats;
+    }
+
+    int64_t setSoftHeapLimit(const int64_t bytes)
+    {
+        if (bytes < 0) throw CppqlError("Soft heap limit must not be negative.");
+        return sqlite3_soft_heap_limit64(bytes);
+    }
+
+    int64_t getSoftHeapLimit() noexcept { return sqlite3_soft_heap_limit64(-1); }
+
+    int64_t setHardHeapLimit(const int64_t bytes)
+    {
+        if (bytes < 0) throw CppqlError("Hard heap limit must not be negative.");
+        return sqlite3_hard_heap_limit64(bytes);
+    }
+
+    int64_t getHardHeapLimit() noexcept { return sqlite3_hard_heap_limit64(-1); }
+}  // namespace sql
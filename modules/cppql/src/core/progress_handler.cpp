@@ -0,0 +1,104 @@
+#include "cppql/core/progress_handler.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <ranges>
+#include <utility>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/cancellation.h"
+#include "cppql/error/cppql_error.h"
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    int32_t ProgressHandler::getInstructions() const noexcept { return instructions; }
+
+    bool ProgressHandler::isActive() const noexcept { return userCallback || !scopes.empty(); }
+
+    ////////////////////////////////////////////////////////////////
+    // Setters.
+    ////////////////////////////////////////////////////////////////
+
+    void ProgressHandler::setCallback(const int32_t n, std::function<bool()> f)
+    {
+        if (n <= 0) throw CppqlError("Number of progress handler instructions must be positive.");
+        if (!f) throw CppqlError("Progress handler callback is empty.");
+
+        instructions = n;
+        userCallback = std::move(f);
+    }
+
+    void ProgressHandler::clearCallback() noexcept
+    {
+        instructions = default_instructions;
+        userCallback = nullptr;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Scopes.
+    ////////////////////////////////////////////////////////////////
+
+    void ProgressHandler::pushScope(const CancellationScope& scope) { scopes.push_back(&scope); }
+
+    void ProgressHandler::popScope(const CancellationScope& scope) noexcept
+    {
+        if (const auto it = std::ranges::find(scopes, &scope); it != scopes.end()) scopes.erase(it);
+    }
+
+    std::optional<InterruptReason> ProgressHandler::checkScopes() const noexcept
+    {
+        for (const auto* scope : scopes | std::views::reverse)
+            if (const auto r = scope->check()) return r;
+        return std::nullopt;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // ...
+    ////////////////////////////////////////////////////////////////
+
+    InterruptReason ProgressHandler::takeReason() noexcept
+    {
+        return std::exchange(reason, std::nullopt).value_or(InterruptReason::Interrupt);
+    }
+
+    bool ProgressHandler::progress() noexcept
+    {
+        if (const auto r = checkScopes())
+        {
+            reason = r;
+            return true;
+        }
+
+        // Exceptions cannot pass through sqlite. Treat them as a request to stop.
+        try
+        {
+            if (userCallback && userCallback())
+            {
+                reason = InterruptReason::ProgressHandler;
+                return true;
+            }
+        }
+        catch (...)
+        {
+            reason = InterruptReason::ProgressHandler;
+            return true;
+        }
+
+        return false;
+    }
+
+    int32_t ProgressHandler::callback(void* handler) noexcept
+    {
+        return static_cast<ProgressHandler*>(handler)->progress() ? 1 : 0;
+    }
+}  // namespace sql
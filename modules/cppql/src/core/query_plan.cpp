@@ -0,0 +1,181 @@
+#include "cppql/core/query_plan.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+#include <format>
+#include <unordered_set>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/cppql_error.h"
+
+namespace sql
+{
+    namespace
+    {
+        void addChildren(QueryPlanNode& node, const std::vector<QueryPlanNode>& rows)
+        {
+            for (const auto& row : rows)
+            {
+                if (row.parent != node.id) continue;
+                auto& child = node.children.emplace_back(row.id, row.parent, row.detail);
+                addChildren(child, rows);
+            }
+        }
+
+        template<typename F>
+        bool anyOf(const std::vector<QueryPlanNode>& nodes, F&& f)
+        {
+            return std::ranges::any_of(nodes, [&f](const auto& n) { return f(n) || anyOf(n.children, f); });
+        }
+
+        void formatNodes(std::string& out, const std::vector<QueryPlanNode>& nodes, const std::string& prefix)
+        {
+            for (size_t i = 0; i < nodes.size(); i++)
+            {
+                const auto last = i + 1 == nodes.size();
+                out += std::format("{}{}{}\n", prefix, last ? "`--" : "|--", nodes[i].detail);
+                formatNodes(out, nodes[i].children, prefix + (last ? "   " : "|  "));
+            }
+        }
+
+        void flatten(const std::vector<QueryPlanNode>& nodes, std::vector<std::string>& details)
+        {
+            for (const auto& n : nodes)
+            {
+                details.emplace_back(n.detail);
+                flatten(n.children, details);
+            }
+        }
+
+        [[nodiscard]] std::vector<std::string> flatten(const std::vector<QueryPlanNode>& nodes)
+        {
+            std::vector<std::string> details;
+            flatten(nodes, details);
+            return details;
+        }
+
+        /**
+         * \brief Report details that contain the text and occur more often in the plan than in the baseline.
+         */
+        void findAdded(const std::vector<std::string>& plan,
+                       std::vector<std::string>        baseline,
+                       const std::string_view          text,
+                       std::vector<std::string>&       regressions)
+        {
+            for (const auto& d : plan)
+            {
+                if (d.find(text) == std::string::npos) continue;
+                if (const auto it = std::ranges::find(baseline, d); it != baseline.end())
+                    baseline.erase(it);
+                else
+                    regressions.emplace_back(std::format("Added \"{}\".", d));
+            }
+        }
+    }  // namespace
+
+    ////////////////////////////////////////////////////////////////
+    // Constructors.
+    ////////////////////////////////////////////////////////////////
+
+    QueryPlan::QueryPlan(const std::vector<QueryPlanNode>& rows)
+    {
+        // Rows are ordered such that parents always come before their children. Id 0 is the virtual root.
+        QueryPlanNode root;
+        addChildren(root, rows);
+        nodes = std::move(root.children);
+    }
+
+    QueryPlan QueryPlan::parse(std::string_view text)
+    {
+        std::vector<QueryPlanNode> rows;
+
+        // Id of the last node at each depth.
+        std::vector<int32_t> parents;
+        while (!text.empty())
+        {
+            const auto end  = text.find('\n');
+            auto       line = text.substr(0, end);
+            text            = end == std::string_view::npos ? std::string_view{} : text.substr(end + 1);
+            if (line.empty() || line == "QUERY PLAN") continue;
+
+            // Every level of indentation is 3 characters wide.
+            size_t depth = 0;
+            while (line.starts_with("|  ") || line.starts_with("   "))
+            {
+                line.remove_prefix(3);
+                depth++;
+            }
+            if (!line.starts_with("|--") && !line.starts_with("`--"))
+                throw CppqlError(std::format("Failed to parse query plan line \"{}\".", line));
+            if (depth > parents.size())
+                throw CppqlError(std::format("Query plan line \"{}\" is indented too far.", line));
+            line.remove_prefix(3);
+
+            const auto id = static_cast<int32_t>(rows.size()) + 1;
+            rows.emplace_back(id, depth == 0 ? 0 : parents[depth - 1], std::string(line));
+            parents.resize(depth);
+            parents.emplace_back(id);
+        }
+
+        return QueryPlan(rows);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    const std::vector<QueryPlanNode>& QueryPlan::getNodes() const noexcept { return nodes; }
+
+    bool QueryPlan::contains(const std::string_view text) const
+    {
+        return anyOf(nodes, [text](const QueryPlanNode& n) { return n.detail.find(text) != std::string::npos; });
+    }
+
+    bool QueryPlan::usesFullScan(const std::string_view table) const
+    {
+        const auto scan = std::format("SCAN {}", table);
+        return anyOf(nodes, [&scan](const QueryPlanNode& n) {
+            // Match "SCAN t" and "SCAN t USING ...", but not "SCAN t2".
+            return n.detail.starts_with(scan) && (n.detail.size() == scan.size() || n.detail[scan.size()] == ' ');
+        });
+    }
+
+    std::string QueryPlan::toString() const
+    {
+        std::string out = "QUERY PLAN\n";
+        formatNodes(out, nodes, "");
+        return out;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Compare.
+    ////////////////////////////////////////////////////////////////
+
+    std::vector<std::string> QueryPlan::findRegressions(const QueryPlan& baseline) const
+    {
+        std::vector<std::string> regressions;
+        const auto               details         = flatten(nodes);
+        const auto               baselineDetails = flatten(baseline.nodes);
+
+        // Tables that are now scanned instead of searched.
+        std::unordered_set<std::string_view> tables;
+        for (const std::string_view d : details)
+        {
+            if (!d.starts_with("SCAN ")) continue;
+            const auto table = d.substr(5, d.find(' ', 5) - 5);
+            if (tables.insert(table).second && !baseline.usesFullScan(table))
+                regressions.emplace_back(std::format("Full scan of {}: \"{}\".", table, d));
+        }
+
+        findAdded(details, baselineDetails, "USE TEMP B-TREE", regressions);
+        findAdded(details, baselineDetails, "AUTOMATIC", regressions);
+
+        return regressions;
+    }
+}  // namespace sql
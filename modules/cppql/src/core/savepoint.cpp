@@ -0,0 +1,80 @@
+#include "cppql/core/savepoint.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cassert>
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/database.h"
+#include "cppql/error/sqlite_error.h"
+
+namespace sql
+{
+    Savepoint::Savepoint(Database& db) : database(&db), depth(db.savepointDepth)
+    {
+        if (const auto res = database->runPersistent(database->getSavepointCode(depth)[0]); !res)
+            throw SqliteError("Failed to open savepoint.", res.code, res.extendedCode);
+        database->savepointDepth++;
+    }
+
+    Savepoint::~Savepoint() noexcept
+    {
+        if (released) return;
+
+        // Errors are ignored here. They occur if the savepoint was already undone, e.g. by a rollback of the
+        // enclosing transaction.
+        released = true;
+        try
+        {
+            const auto& code = database->getSavepointCode(depth);
+            static_cast<void>(database->runPersistent(code[2]));
+            static_cast<void>(database->runPersistent(code[1]));
+        }
+        catch (...)
+        {
+        }
+        database->savepointDepth = depth;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    size_t Savepoint::getDepth() const noexcept { return depth; }
+
+    ////////////////////////////////////////////////////////////////
+    // Commit.
+    ////////////////////////////////////////////////////////////////
+
+    void Savepoint::release()
+    {
+        assert(!released);
+        assert(database->savepointDepth == depth + 1);
+
+        released                 = true;
+        database->savepointDepth = depth;
+        if (const auto res = database->runPersistent(database->getSavepointCode(depth)[1]); !res)
+            throw SqliteError("Failed to release savepoint.", res.code, res.extendedCode);
+    }
+
+    void Savepoint::rollback()
+    {
+        assert(!released);
+        assert(database->savepointDepth == depth + 1);
+
+        released                 = true;
+        database->savepointDepth = depth;
+
+        // ROLLBACK TO leaves the savepoint on the stack, so it still needs to be released.
+        const auto& code = database->getSavepointCode(depth);
+        if (const auto res = database->runPersistent(code[2]); !res)
+            throw SqliteError("Failed to rollback savepoint.", res.code, res.extendedCode);
+        if (const auto res = database->runPersistent(code[1]); !res)
+            throw SqliteError("Failed to release savepoint.", res.code, res.extendedCode);
+    }
+}  // namespace sql
@@ -0,0 +1,131 @@
+#include "cppql/core/slow_query_log.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <format>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/cppql_error.h"
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // FileSlowQuerySink.
+    ////////////////////////////////////////////////////////////////
+
+    FileSlowQuerySink::FileSlowQuerySink(const std::filesystem::path& file) : stream(file, std::ios::app)
+    {
+        if (!stream) throw CppqlError(std::format("Failed to open slow query log {}.", file.string()));
+    }
+
+    void FileSlowQuerySink::write(const SlowQueryRecord& record)
+    {
+        const auto timestamp =
+          std::chrono::duration_cast<std::chrono::milliseconds>(record.timestamp.time_since_epoch()).count();
+        const auto duration = std::chrono::duration_cast<std::chrono::microseconds>(record.duration).count();
+        const auto line     = std::format("{}\t{}\t{}\t{}\n", timestamp, duration, record.rows, record.expandedSql);
+
+        std::scoped_lock lock(mutex);
+        stream << line;
+        stream.flush();
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // RingBufferSlowQuerySink.
+    ////////////////////////////////////////////////////////////////
+
+    RingBufferSlowQuerySink::RingBufferSlowQuerySink(const size_t cap) : capacity(cap) {}
+
+    void RingBufferSlowQuerySink::write(const SlowQueryRecord& record)
+    {
+        std::scoped_lock lock(mutex);
+        if (capacity == 0) return;
+        if (records.size() == capacity) records.pop_front();
+        records.push_back(record);
+    }
+
+    std::vector<SlowQueryRecord> RingBufferSlowQuerySink::getRecords() const
+    {
+        std::scoped_lock lock(mutex);
+        return {records.begin(), records.end()};
+    }
+
+    void RingBufferSlowQuerySink::clear()
+    {
+        std::scoped_lock lock(mutex);
+        records.clear();
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // SlowQueryLog.
+    ////////////////////////////////////////////////////////////////
+
+    SlowQueryLog::SlowQueryLog(const std::chrono::nanoseconds limit, SlowQuerySinkPtr s) :
+        threshold(limit), sink(std::move(s))
+    {
+        if (!sink) throw CppqlError("Slow query log requires a sink.");
+    }
+
+    std::chrono::nanoseconds SlowQueryLog::getThreshold() const noexcept { return threshold; }
+
+    const SlowQuerySinkPtr& SlowQueryLog::getSink() const noexcept { return sink; }
+
+    int32_t SlowQueryLog::callback(const uint32_t type, void* context, void* p, void* x) noexcept
+    {
+        auto* log       = static_cast<SlowQueryLog*>(context);
+        auto* statement = static_cast<sqlite3_stmt*>(p);
+
+        // Exceptions cannot be propagated through sqlite. Losing a record is preferable to terminating.
+        try
+        {
+            if (type == SQLITE_TRACE_ROW)
+                log->row(statement);
+            else if (type == SQLITE_TRACE_PROFILE)
+                log->profile(statement, std::chrono::nanoseconds(*static_cast<sqlite3_int64*>(x)));
+        }
+        catch (...)
+        {
+        }
+
+        return 0;
+    }
+
+    void SlowQueryLog::row(sqlite3_stmt* statement) { rowCounts[statement]++; }
+
+    void SlowQueryLog::profile(sqlite3_stmt* statement, const std::chrono::nanoseconds duration)
+    {
+        // Take row count, so that the next execution of the same statement starts at 0.
+        int64_t rows = 0;
+        if (const auto it = rowCounts.find(statement); it != rowCounts.end())
+        {
+            rows = it->second;
+            rowCounts.erase(it);
+        }
+
+        if (duration < threshold) return;
+
+        SlowQueryRecord record;
+        record.sql       = sqlite3_sql(statement);
+        record.duration  = duration;
+        record.rows      = rows;
+        record.timestamp = std::chrono::system_clock::now();
+        if (auto* expanded = sqlite3_expanded_sql(statement))
+        {
+            record.expandedSql = expanded;
+            sqlite3_free(expanded);
+        }
+
+        sink->write(record);
+    }
+}  // namespace sql
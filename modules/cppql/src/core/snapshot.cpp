@@ -0,0 +1,59 @@
+#include "cppql/core/snapshot.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <utility>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/error/cppql_error.h"
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // Constructors.
+    ////////////////////////////////////////////////////////////////
+
+    Snapshot::Snapshot(sqlite3_snapshot* handle) noexcept : snapshot(handle) {}
+
+    Snapshot::Snapshot(Snapshot&& other) noexcept : snapshot(std::exchange(other.snapshot, nullptr)) {}
+
+    Snapshot::~Snapshot() noexcept
+    {
+#ifdef CPPQL_ENABLE_SNAPSHOT
+        if (snapshot) sqlite3_snapshot_free(snapshot);
+#endif
+    }
+
+    Snapshot& Snapshot::operator=(Snapshot&& other) noexcept
+    {
+        if (this != &other) std::swap(snapshot, other.snapshot);
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    sqlite3_snapshot* Snapshot::get() const noexcept { return snapshot; }
+
+    int32_t Snapshot::compare(const Snapshot& other) const
+    {
+#ifdef CPPQL_ENABLE_SNAPSHOT
+        return sqlite3_snapshot_cmp(snapshot, other.snapshot);
+#else
+        static_cast<void>(other);
+        throw CppqlError("Snapshots are not available. Build with CPPQL_ENABLE_SNAPSHOT to enable them.");
+#endif
+    }
+}  // namespace sql
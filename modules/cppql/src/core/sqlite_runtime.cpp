@@ -0,0 +1,187 @@
+#include "cppql/core/sqlite_runtime.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <format>
+#include <mutex>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/assert.h"
+#include "cppql/error/cppql_error.h"
+#include "cppql/error/sqlite_error.h"
+
+namespace sql
+{
+    namespace
+    {
+        std::mutex runtime_mutex;
+        int64_t    runtime_count = 0;
+
+        [[nodiscard]] int32_t toSqlite(const ThreadingMode mode) noexcept
+        {
+            switch (mode)
+            {
+            case ThreadingMode::SingleThread: return SQLITE_CONFIG_SINGLETHREAD;
+            case ThreadingMode::MultiThread: return SQLITE_CONFIG_MULTITHREAD;
+            case ThreadingMode::Serialized: return SQLITE_CONFIG_SERIALIZED;
+            }
+
+            return SQLITE_CONFIG_SERIALIZED;
+        }
+
+        [[nodiscard]] bool isEmpty(const RuntimeConfig& config) noexcept
+        {
+            return !config.threadingMode && !config.mmapSize && !config.mmapLimit && !config.uri && !config.memory;
+        }
+
+        void check(const int32_t res, const char* option)
+        {
+            if (res == SQLITE_MISUSE)
+                throw SqliteError(
+                  std::format("Failed to configure {}. sqlite must not be initialized yet.", option), res, SQLITE_OK);
+            if (res != SQLITE_OK) throw SqliteError(std::format("Failed to configure {}.", option), res, SQLITE_OK);
+        }
+
+        void configure(const RuntimeConfig& config)
+        {
+            if (config.threadingMode) check(sqlite3_config(toSqlite(*config.threadingMode)), "threading mode");
+
+            // Negative values keep the compile-time default.
+            if (config.mmapSize || config.mmapLimit)
+                check(sqlite3_config(SQLITE_CONFIG_MMAP_SIZE,
+                                     static_cast<sqlite3_int64>(config.mmapSize.value_or(-1)),
+                                     static_cast<sqlite3_int64>(config.mmapLimit.value_or(-1))),
+                      "mmap size");
+
+            if (config.uri) check(sqlite3_config(SQLITE_CONFIG_URI, *config.uri ? 1 : 0), "URI handling");
+
+            if (config.memory) configureMemory(*config.memory);
+        }
+
+        void acquire(const RuntimeConfig* config)
+        {
+            std::scoped_lock lock(runtime_mutex);
+
+            if (config && !isEmpty(*config))
+            {
+                if (runtime_count > 0) throw CppqlError("Cannot configure sqlite while it is in use.");
+                configure(*config);
+            }
+
+            if (runtime_count == 0)
+            {
+                if (const auto res = sqlite3_initialize(); res != SQLITE_OK)
+                    throw SqliteError(std::format("Failed to initialize sqlite."), res, SQLITE_OK);
+            }
+
+            runtime_count++;
+        }
+    }  // namespace
+
+    ////////////////////////////////////////////////////////////////
+    // Constructors.
+    ////////////////////////////////////////////////////////////////
+
+    SqliteRuntime::SqliteRuntime()
+    {
+        acquire(nullptr);
+        acquired = true;
+    }
+
+    SqliteRuntime::SqliteRuntime(const RuntimeConfig& config)
+    {
+        acquire(&config);
+        acquired = true;
+    }
+
+    SqliteRuntime::SqliteRuntime(const SqliteRuntime& other) : shutdown(other.shutdown)
+    {
+        if (other.acquired)
+        {
+            acquire(nullptr);
+            acquired = true;
+        }
+    }
+
+    SqliteRuntime::SqliteRuntime(SqliteRuntime&& other) noexcept :
+        acquired(other.acquired), shutdown(other.shutdown)
+    {
+        other.acquired = false;
+    }
+
+    SqliteRuntime::~SqliteRuntime() noexcept { release(); }
+
+    SqliteRuntime& SqliteRuntime::operator=(const SqliteRuntime& other)
+    {
+        if (this == &other) return *this;
+        if (other.acquired && !acquired)
+        {
+            acquire(nullptr);
+            acquired = true;
+        }
+        else if (!other.acquired)
+            release();
+        shutdown = other.shutdown;
+        return *this;
+    }
+
+    SqliteRuntime& SqliteRuntime::operator=(SqliteRuntime&& other) noexcept
+    {
+        if (this == &other) return *this;
+        release();
+        acquired       = other.acquired;
+        shutdown       = other.shutdown;
+        other.acquired = false;
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    bool SqliteRuntime::holdsReference() const noexcept { return acquired; }
+
+    bool SqliteRuntime::getShutdown() const noexcept { return shutdown; }
+
+    int64_t SqliteRuntime::getUseCount()
+    {
+        std::scoped_lock lock(runtime_mutex);
+        return runtime_count;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Setters.
+    ////////////////////////////////////////////////////////////////
+
+    void SqliteRuntime::setShutdown(const bool value) noexcept { shutdown = value; }
+
+    ////////////////////////////////////////////////////////////////
+    // ...
+    ////////////////////////////////////////////////////////////////
+
+    void SqliteRuntime::release() noexcept
+    {
+        if (!acquired) return;
+        acquired = false;
+
+        std::scoped_lock lock(runtime_mutex);
+        CPPQL_ASSERT(runtime_count > 0);
+        if (--runtime_count == 0 && shutdown)
+        {
+            const auto res = sqlite3_shutdown();
+            CPPQL_ASSERT(res == SQLITE_OK);
+            static_cast<void>(res);
+        }
+    }
+}  // namespace sql
@@ -1,5 +1,11 @@
 #include "cppql/core/statement.h"
 
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <utility>
+
 ////////////////////////////////////////////////////////////////
 // External includes.
 ////////////////////////////////////////////////////////////////
@@ -11,6 +17,8 @@
 ////////////////////////////////////////////////////////////////
 
 #include "cppql/core/database.h"
+#include "cppql/error/interrupt_error.h"
+#include "cppql/error/sqlite_error.h"
 
 namespace sql
 {
@@ -56,9 +64,27 @@ namespace sql
         if (prepare) this->prepare();
     }
 
-    Statement::~Statement()
+    Statement::Statement(Statement&& other) noexcept :
+        db(other.db),
+        statement(std::exchange(other.statement, nullptr)),
+        sql(std::move(other.sql)),
+        prepareResult(std::move(other.prepareResult))
+    {
+    }
+
+    Statement::~Statement() { release(); }
+
+    Statement& Statement::operator=(Statement&& other) noexcept
     {
-        if (statement) sqlite3_finalize(statement);
+        if (this != &other)
+        {
+            release();
+            db            = other.db;
+            statement     = std::exchange(other.statement, nullptr);
+            sql           = std::move(other.sql);
+            prepareResult = std::move(other.prepareResult);
+        }
+        return *this;
     }
 
     ////////////////////////////////////////////////////////////////
@@ -82,6 +108,91 @@ namespace sql
 #endif
     }
 
+    StatementStats Statement::getStats(const bool reset) const noexcept
+    {
+        if (!statement) return {};
+
+        const auto resetFlag = reset ? 1 : 0;
+        const auto get       = [&](const int32_t op) -> int64_t {
+            return sqlite3_stmt_status(statement, op, resetFlag);
+        };
+
+        StatementStats stats;
+        stats.fullscanSteps = get(SQLITE_STMTSTATUS_FULLSCAN_STEP);
+        stats.sorts         = get(SQLITE_STMTSTATUS_SORT);
+        stats.autoIndexes   = get(SQLITE_STMTSTATUS_AUTOINDEX);
+        stats.vmSteps       = get(SQLITE_STMTSTATUS_VM_STEP);
+        stats.reprepares    = get(SQLITE_STMTSTATUS_REPREPARE);
+        stats.runs          = get(SQLITE_STMTSTATUS_RUN);
+        // Memory usage is not a counter and is never reset.
+        stats.memoryUsed = get(SQLITE_STMTSTATUS_MEMUSED);
+        return stats;
+    }
+
+    std::vector<ScanStatus> Statement::getScanStatus() const
+    {
+#ifdef CPPQL_ENABLE_SCANSTATUS
+        std::vector<ScanStatus> loops;
+        if (!statement) return loops;
+
+        for (int32_t i = 0;; i++)
+        {
+            // Returns nonzero once the index is out of range.
+#if SQLITE_VERSION_NUMBER >= 3042000
+            const auto get = [&](const int32_t op, void* out) {
+                return sqlite3_stmt_scanstatus_v2(statement, i, op, 0, out) == 0;
+            };
+#else
+            const auto get = [&](const int32_t op, void* out) {
+                return sqlite3_stmt_scanstatus(statement, i, op, out) == 0;
+            };
+#endif
+
+            sqlite3_int64 loopCount = 0;
+            if (!get(SQLITE_SCANSTAT_NLOOP, &loopCount)) break;
+
+            auto& loop = loops.emplace_back();
+            loop.loops = loopCount;
+
+            sqlite3_int64 visits = 0;
+            get(SQLITE_SCANSTAT_NVISIT, &visits);
+            loop.rowsVisited = visits;
+            get(SQLITE_SCANSTAT_EST, &loop.estimatedRows);
+
+            const char* name    = nullptr;
+            const char* explain = nullptr;
+            get(SQLITE_SCANSTAT_NAME, static_cast<void*>(&name));
+            get(SQLITE_SCANSTAT_EXPLAIN, static_cast<void*>(&explain));
+            if (name) loop.name = name;
+            if (explain) loop.explain = explain;
+
+            int selectId = 0;
+            get(SQLITE_SCANSTAT_SELECTID, &selectId);
+            loop.selectId = selectId;
+
+#if SQLITE_VERSION_NUMBER >= 3042000
+            int parentId = 0;
+            get(SQLITE_SCANSTAT_PARENTID, &parentId);
+            loop.parentId = parentId;
+
+            sqlite3_int64 cycles = 0;
+            if (get(SQLITE_SCANSTAT_NCYCLE, &cycles)) loop.cycles = cycles;
+#endif
+        }
+
+        return loops;
+#else
+        throw CppqlError("Scan status is not available. Build with CPPQL_ENABLE_SCANSTATUS to enable it.");
+#endif
+    }
+
+    void Statement::resetScanStatus() const noexcept
+    {
+#ifdef CPPQL_ENABLE_SCANSTATUS
+        if (statement) sqlite3_stmt_scanstatus_reset(statement);
+#endif
+    }
+
     ////////////////////////////////////////////////////////////////
     // ...
     ////////////////////////////////////////////////////////////////
@@ -91,6 +202,13 @@ namespace sql
         // If statement was already prepared, return generic error.
         if (statement) return Result::fromCode(*db, SQLITE_ERROR, false);
 
+        // Try to reuse a cached statement.
+        if (statement = db->statementCache.acquire(getSql()); statement)
+        {
+            prepareResult = Result::fromCode(*db, SQLITE_OK, true);
+            return *prepareResult;
+        }
+
         // Try to prepare statement.
         const auto code =
           sqlite3_prepare_v2(db->db, getSql().c_str(), static_cast<int32_t>(getSql().size()), &statement, nullptr);
@@ -107,7 +225,31 @@ namespace sql
     Result Statement::reset() const noexcept
     {
         const auto code = sqlite3_reset(statement);
-        return Result::fromCode(*db, code, code == SQLITE_OK);
+        const auto res  = Result::fromCode(*db, code, code == SQLITE_OK);
+        db->countStatementReset();
+        return res;
+    }
+
+    void Statement::throwError(const std::string& msg, const Result& res, const std::source_location loc) const
+    {
+        if (res.code == SQLITE_INTERRUPT) throw InterruptError(msg, db->takeInterruptReason(), loc);
+        throw SqliteError(msg, res.code, res.extendedCode, loc);
+    }
+
+    void Statement::checkCancellation() const
+    {
+        if (const auto reason = db->checkCancellation())
+        {
+            static_cast<void>(reset());
+            throw InterruptError("Statement was cancelled.", *reason);
+        }
+    }
+
+    void Statement::release() noexcept
+    {
+        if (!statement) return;
+        db->statementCache.release(sql, statement);
+        statement = nullptr;
     }
 
     ////////////////////////////////////////////////////////////////
@@ -312,6 +454,13 @@ namespace sql
         std::memcpy(value.data(), data, size);
     }
 
+    void Statement::column(const int32_t index, std::string_view& value) const noexcept
+    {
+        const auto* const data = reinterpret_cast<const char*>(sqlite3_column_text(statement, index));
+        const auto        size = static_cast<size_t>(sqlite3_column_bytes(statement, index));
+        value                  = data ? std::string_view(data, size) : std::string_view();
+    }
+
     std::pair<const void*, size_t> Statement::columnBlob(const int32_t index) const
     {
         const auto* data = sqlite3_column_blob(statement, index);
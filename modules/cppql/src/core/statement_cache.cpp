@@ -0,0 +1,129 @@
+#include "cppql/core/statement_cache.h"
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+namespace sql
+{
+    ////////////////////////////////////////////////////////////////
+    // Constructors.
+    ////////////////////////////////////////////////////////////////
+
+    StatementCache::StatementCache(const size_t cap) : capacity(cap) {}
+
+    StatementCache::StatementCache(StatementCache&& other) noexcept :
+        capacity(other.capacity),
+        entries(std::move(other.entries)),
+        lookup(std::move(other.lookup)),
+        hits(other.hits),
+        misses(other.misses)
+    {
+        other.entries.clear();
+        other.lookup.clear();
+    }
+
+    StatementCache::~StatementCache() noexcept { clear(); }
+
+    StatementCache& StatementCache::operator=(StatementCache&& other) noexcept
+    {
+        if (this != &other)
+        {
+            clear();
+            capacity = other.capacity;
+            entries  = std::move(other.entries);
+            lookup   = std::move(other.lookup);
+            hits     = other.hits;
+            misses   = other.misses;
+            other.entries.clear();
+            other.lookup.clear();
+        }
+        return *this;
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // Getters.
+    ////////////////////////////////////////////////////////////////
+
+    size_t StatementCache::getCapacity() const noexcept { return capacity; }
+
+    size_t StatementCache::getSize() const noexcept { return entries.size(); }
+
+    size_t StatementCache::getHits() const noexcept { return hits; }
+
+    size_t StatementCache::getMisses() const noexcept { return misses; }
+
+    ////////////////////////////////////////////////////////////////
+    // Setters.
+    ////////////////////////////////////////////////////////////////
+
+    void StatementCache::setCapacity(const size_t value) noexcept
+    {
+        capacity = value;
+        if (entries.size() > capacity) evict(entries.size() - capacity);
+    }
+
+    ////////////////////////////////////////////////////////////////
+    // ...
+    ////////////////////////////////////////////////////////////////
+
+    sqlite3_stmt* StatementCache::acquire(const std::string& sql) noexcept
+    {
+        if (capacity == 0) return nullptr;
+
+        const auto it = lookup.find(sql);
+        if (it == lookup.end())
+        {
+            misses++;
+            return nullptr;
+        }
+
+        hits++;
+        auto*      statement = it->second->second;
+        const auto entry     = it->second;
+        lookup.erase(it);
+        entries.erase(entry);
+        return statement;
+    }
+
+    void StatementCache::release(const std::string& sql, sqlite3_stmt* statement) noexcept
+    {
+        if (!statement) return;
+
+        // Cache is disabled or there already is an identical statement.
+        if (capacity == 0 || lookup.contains(sql))
+        {
+            sqlite3_finalize(statement);
+            return;
+        }
+
+        // Return statement to its initial state. Errors of the last step are also returned by reset and are
+        // irrelevant here.
+        static_cast<void>(sqlite3_reset(statement));
+        static_cast<void>(sqlite3_clear_bindings(statement));
+
+        entries.emplace_front(sql, statement);
+        lookup.emplace(entries.front().first, entries.begin());
+
+        if (entries.size() > capacity) evict(entries.size() - capacity);
+    }
+
+    void StatementCache::clear() noexcept { evict(entries.size()); }
+
+    ////////////////////////////////////////////////////////////////
+    // Private methods.
+    ////////////////////////////////////////////////////////////////
+
+    void StatementCache::evict(size_t count) noexcept
+    {
+        while (count-- > 0 && !entries.empty())
+        {
+            auto& [sql, statement] = entries.back();
+            lookup.erase(sql);
+            sqlite3_finalize(statement);
+            entries.pop_back();
+        }
+    }
+}  // namespace sql
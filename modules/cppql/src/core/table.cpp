@@ -24,8 +24,26 @@
 
 namespace sql
 {
+    namespace
+    {
+        const std::string main_schema = "main";
+
+        /**
+         * \brief Get the schema name to pass to sqlite. Returns a reference, so that it can be bound statically.
+         */
+        [[nodiscard]] const std::string& schemaOrMain(const std::string& schema) noexcept
+        {
+            return schema.empty() ? main_schema : schema;
+        }
+    }  // namespace
+
     Table::Table(Database* database, std::string tableName) : db(database), name(std::move(tableName)) {}
 
+    Table::Table(Database* database, std::string schemaName, std::string tableName) :
+        db(database), schema(std::move(schemaName)), name(std::move(tableName))
+    {
+    }
+
     void Table::commit()
     {
         requireNotCommitted();
@@ -100,7 +118,8 @@ namespace sql
         if (options.strict) opts += options.withoutRowid ? ",STRICT" : "STRICT";
 
         // Format full statement.
-        auto sql = std::format("CREATE TABLE {} ({} {}) {};", name, std::move(cols), std::move(pk), std::move(opts));
+        auto sql = std::format(
+          "CREATE TABLE {} ({} {}) {};", getQualifiedName(), std::move(cols), std::move(pk), std::move(opts));
         return sql;
     }
 
@@ -122,6 +141,15 @@ namespace sql
 
     const std::string& Table::getName() const noexcept { return name; }
 
+    const std::string& Table::getSchema() const noexcept { return schema; }
+
+    std::string Table::getQualifiedName() const { return qualify(schema, name); }
+
+    std::string Table::qualify(const std::string& schemaName, const std::string& tableName)
+    {
+        return schemaName.empty() ? tableName : std::format("{}.{}", schemaName, tableName);
+    }
+
     bool Table::getWithoutRowid() const noexcept { return options.withoutRowid; }
 
     bool Table::getStrict() const noexcept { return options.strict; }
@@ -190,61 +218,93 @@ namespace sql
     void Table::readFromDb(
       std::unordered_map<std::string, std::vector<std::tuple<std::string, std::string, std::string>>>& foreignKeys)
     {
-        // Create statement to select all columns.
-        const auto select = db->createStatement("SELECT * FROM " + getName() + ";", true);
+        // Select all columns. Hidden columns of virtual tables are not returned by SELECT *, so they are skipped.
+        const auto select = db->createStatement(
+          "SELECT name, type, \"notnull\", pk FROM pragma_table_xinfo(?, ?) WHERE hidden != 1 ORDER BY cid;", true);
+        if (const auto res = select.bindStaticText(Statement::getFirstBindIndex(), getName()); !res)
+            throw SqliteError(std::format("Could not retrieve columns of table {}.", getName()),
+                              res.code,
+                              res.extendedCode);
+        if (const auto res = select.bindStaticText(Statement::getFirstBindIndex() + 1, schemaOrMain(schema)); !res)
+            throw SqliteError(std::format("Could not retrieve columns of table {}.", getName()),
+                              res.code,
+                              res.extendedCode);
 
         // Create columns.
-        const auto columnCount = sqlite3_column_count(select.get());
-        for (auto i = 0; i < columnCount; i++)
+        auto res = select.step();
+        while (res.code == SQLITE_ROW)
         {
-            // Get column name.
-            const auto columnName = std::string(sqlite3_column_name(select.get(), i));
-
-            // Get column metadata.
-            const char* dt      = nullptr;
-            const char* coll    = nullptr;
-            auto        notNull = 0, primaryKey = 0, autoInc = 0;
-            if (const auto res = sqlite3_table_column_metadata(db->get(),
-                                                               nullptr,
-                                                               getName().c_str(),
-                                                               columnName.c_str(),
-                                                               &dt,
-                                                               &coll,
-                                                               &notNull,
-                                                               &primaryKey,
-                                                               &autoInc);
-                res != SQLITE_OK)
-                throw SqliteError(std::format("Could not retrieve column metadata."), res, SQLITE_OK);
-
-            // Determine column type. If returned data type string is null, column has a null type.
-            auto columnType = Column::Type::Null;
-            if (dt) fromString(std::string(dt), columnType);
-
-            // Create column.
-            auto& col = createColumn(columnName, columnType);
-            if (notNull) col.notNull();
-            if (primaryKey) col.primaryKey(autoInc > 0, ConflictClause::Abort);
+            readColumn(select.column<std::string>(0),
+                       select.column<std::string>(1),
+                       select.column<int32_t>(2) != 0,
+                       select.column<int32_t>(3) != 0);
+            res = select.step();
         }
-
-        const auto fks = db->createStatement("PRAGMA foreign_key_list(" + getName() + ");", true);
+        if (!res)
+            throw SqliteError(std::format("Could not retrieve columns of table {}.", getName()),
+                              res.code,
+                              res.extendedCode);
+
+        const auto fks =
+          db->createStatement("SELECT \"table\", \"from\", \"to\" FROM pragma_foreign_key_list(?, ?);", true);
+        if (const auto bindRes = fks.bindStaticText(Statement::getFirstBindIndex(), getName()); !bindRes)
+            throw SqliteError(std::format("Could not retrieve foreign keys of table {}.", getName()),
+                              bindRes.code,
+                              bindRes.extendedCode);
+        if (const auto bindRes = fks.bindStaticText(Statement::getFirstBindIndex() + 1, schemaOrMain(schema)); !bindRes)
+            throw SqliteError(std::format("Could not retrieve foreign keys of table {}.", getName()),
+                              bindRes.code,
+                              bindRes.extendedCode);
         while (fks.step().code == SQLITE_ROW)
         {
-            const auto tableName    = fks.column<std::string>(2);
-            const auto columnName   = fks.column<std::string>(3);
-            const auto fkColumnName = fks.column<std::string>(4);
+            // Foreign keys always reference a table in the same database.
+            const auto tableName    = qualify(schema, fks.column<std::string>(0));
+            const auto columnName   = fks.column<std::string>(1);
+            const auto fkColumnName = fks.column<std::string>(2);
 
-            foreignKeys[getName()].emplace_back(tableName, columnName, fkColumnName);
+            foreignKeys[getQualifiedName()].emplace_back(tableName, columnName, fkColumnName);
         }
     }
 
+    void Table::readColumn(const std::string& columnName,
+                           const std::string& declaredType,
+                           const bool         notNull,
+                           const bool         primaryKey)
+    {
+        // Determine column type. If declared type is empty, column has a null type.
+        auto columnType = Column::Type::Null;
+        if (!declaredType.empty()) fromString(declaredType, columnType);
+
+        // Create column.
+        auto& col = createColumn(columnName, columnType);
+        if (notNull) col.notNull();
+        if (!primaryKey) return;
+
+        // Whether a primary key is autoincrement is not part of the table_xinfo PRAGMA.
+        auto autoInc = 0;
+        if (const auto res = sqlite3_table_column_metadata(db->get(),
+                                                           schemaOrMain(schema).c_str(),
+                                                           getName().c_str(),
+                                                           columnName.c_str(),
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           nullptr,
+                                                           &autoInc);
+            res != SQLITE_OK)
+            throw SqliteError(std::format("Could not retrieve column metadata."), res, SQLITE_OK);
+        col.primaryKey(autoInc > 0, ConflictClause::Abort);
+    }
+
     void Table::resolveForeignKeys(
       const std::unordered_map<std::string, std::vector<std::tuple<std::string, std::string, std::string>>>&
                                                  foreignKeys,
       std::unordered_map<std::string, TablePtr>& tables)
     {
-        if (const auto it = foreignKeys.find(getName()); it == foreignKeys.end()) return;
+        const auto qualifiedName = getQualifiedName();
+        if (const auto it = foreignKeys.find(qualifiedName); it == foreignKeys.end()) return;
 
-        for (const auto& fk : foreignKeys.at(getName()))
+        for (const auto& fk : foreignKeys.at(qualifiedName))
         {
             const auto& tableName    = std::get<0>(fk);
             const auto& columnName   = std::get<1>(fk);
@@ -5,31 +5,77 @@
 ////////////////////////////////////////////////////////////////
 
 #include <cassert>
+#include <chrono>
 #include <format>
+#include <optional>
+#include <string>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
 
 ////////////////////////////////////////////////////////////////
 // Current target includes.
 ////////////////////////////////////////////////////////////////
 
+#include "cppql/core/busy_handler.h"
 #include "cppql/core/database.h"
-#include "cppql/core/statement.h"
+#include "cppql/error/cppql_error.h"
 #include "cppql/error/sqlite_error.h"
 
 namespace sql
 {
-    Transaction::Transaction(Database& db, const Type type) : database(&db)
+    namespace
     {
-        std::string t;
+        const std::string begin_deferred  = "BEGIN DEFERRED TRANSACTION;";
+        const std::string begin_immediate = "BEGIN IMMEDIATE TRANSACTION;";
+        const std::string begin_exclusive = "BEGIN EXCLUSIVE TRANSACTION;";
+        const std::string commit_code     = "COMMIT TRANSACTION;";
+        const std::string rollback_code   = "ROLLBACK TRANSACTION;";
+    }  // namespace
+
+    Transaction::Transaction(Database& db, const Type type, const size_t retries) : database(&db)
+    {
+        const std::string* code = nullptr;
         switch (type)
         {
-        case Type::Deferred: t = "DEFERRED"; break;
-        case Type::Immediate: t = "IMMEDIATE"; break;
-        case Type::Exclusive: t = "EXCLUSIVE"; break;
+        case Type::Deferred: code = &begin_deferred; break;
+        case Type::Immediate: code = &begin_immediate; break;
+        case Type::Exclusive: code = &begin_exclusive; break;
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        auto       res   = database->runPersistent(*code);
+
+        // Retry with backoff. The busy handler is not always invoked, e.g. when a read transaction cannot be upgraded.
+        // Retries stop once the total time since the first attempt, including waits of the busy handler inside of each
+        // attempt, would exceed maxWait.
+        std::optional<BusyHandler> fallback;
+        auto*                      handler = database->getBusyHandler();
+        for (size_t i = 0; i < retries && res.code == SQLITE_BUSY; i++)
+        {
+            if (!handler) handler = &fallback.emplace(BusyPolicy{});
+            const auto spent =
+              std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+            if (!handler->retry(static_cast<int32_t>(i), spent)) break;
+            res = database->runPersistent(*code);
         }
 
-        const auto stmt = database->createStatement(std::format("BEGIN {} TRANSACTION;", std::move(t)), true);
-        if (const auto res = stmt.step(); !res)
-            throw SqliteError("Failed to begin transaction.", res.code, res.extendedCode);
+        if (!res) throw SqliteError("Failed to begin transaction.", res.code, res.extendedCode);
+    }
+
+    Transaction::Transaction(Database& db, const Snapshot& snapshot) : Transaction(db, Type::Deferred)
+    {
+        // The snapshot must be opened before anything is read. If this fails, the destructor rolls back.
+#ifdef CPPQL_ENABLE_SNAPSHOT
+        if (const auto res = sqlite3_snapshot_open(database->get(), "main", snapshot.get()); res != SQLITE_OK)
+            throw SqliteError("Failed to open snapshot.", res, sqlite3_extended_errcode(database->get()));
+#else
+        static_cast<void>(snapshot);
+        throw CppqlError("Snapshots are not available. Build with CPPQL_ENABLE_SNAPSHOT to enable them.");
+#endif
     }
 
     Transaction::~Transaction() noexcept
@@ -41,9 +87,8 @@ namespace sql
     {
         assert(!committed);
 
-        committed       = true;
-        const auto stmt = database->createStatement("COMMIT TRANSACTION;", true);
-        if (const auto res = stmt.step(); !res)
+        committed = true;
+        if (const auto res = database->runPersistent(commit_code); !res)
             throw SqliteError("Failed to commit transaction.", res.code, res.extendedCode);
     }
 
@@ -51,10 +96,26 @@ namespace sql
     {
         assert(!committed);
 
-        committed       = true;
-        const auto stmt = database->createStatement("ROLLBACK TRANSACTION;", true);
-        if (const auto res = stmt.step(); !res)
+        committed = true;
+        if (const auto res = database->runPersistent(rollback_code); !res)
             throw SqliteError("Failed to rollback transaction.", res.code, res.extendedCode);
     }
 
-}  // namespace sql
\ No newline at end of file
+    ////////////////////////////////////////////////////////////////
+    // Snapshot.
+    ////////////////////////////////////////////////////////////////
+
+    Snapshot Transaction::getSnapshot() const
+    {
+        assert(!committed);
+
+#ifdef CPPQL_ENABLE_SNAPSHOT
+        sqlite3_snapshot* snapshot = nullptr;
+        if (const auto res = sqlite3_snapshot_get(database->get(), "main", &snapshot); res != SQLITE_OK)
+            throw SqliteError("Failed to get snapshot.", res, sqlite3_extended_errcode(database->get()));
+        return Snapshot(snapshot);
+#else
+        throw CppqlError("Snapshots are not available. Build with CPPQL_ENABLE_SNAPSHOT to enable them.");
+#endif
+    }
+}  // namespace sql
@@ -0,0 +1,19 @@
+#include "cppql/error/interrupt_error.h"
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+namespace sql
+{
+    InterruptError::InterruptError(const std::string&         msg,
+                                   const InterruptReason      interruptReason,
+                                   const std::source_location loc) :
+        SqliteError(msg, SQLITE_INTERRUPT, SQLITE_INTERRUPT, loc), reason(interruptReason)
+    {
+    }
+
+    InterruptReason InterruptError::getReason() const noexcept { return reason; }
+}  // namespace sql
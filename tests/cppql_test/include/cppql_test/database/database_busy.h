@@ -0,0 +1,15 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "bettertest/mixins/compare_mixin.h"
+#include "bettertest/mixins/exception_mixin.h"
+#include "bettertest/tests/unit_test.h"
+
+class DatabaseBusy final : public bt::UnitTest<DatabaseBusy, bt::CompareMixin, bt::ExceptionMixin>
+{
+public:
+    void operator()() override;
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <string>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "bettertest/mixins/compare_mixin.h"
+#include "bettertest/mixins/exception_mixin.h"
+#include "bettertest/tests/unit_test.h"
+#include "cppql/core/query_plan.h"
+
+////////////////////////////////////////////////////////////////
+// Current target includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql_test/utils.h"
+
+/**
+ * \brief Compares the plans of a fixed set of queries against the golden files in the plans directory, and fails if a
+ * plan got worse (e.g. an index lookup became a full scan, or a temporary b-tree was added for sorting). Run with the
+ * environment variable CPPQL_RECORD_PLANS set to overwrite the golden files instead.
+ */
+class QueryPlanRegression final : public bt::UnitTest<QueryPlanRegression, bt::CompareMixin, bt::ExceptionMixin>,
+                                  utils::DatabaseMember
+{
+public:
+    void operator()() override;
+
+private:
+    void check(const std::string& name, const sql::QueryPlan& plan);
+};
@@ -0,0 +1,164 @@
+#include "cppql_test/cancellation.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <thread>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    /**
+     * \brief Code of a statement that runs for a long time in a single step.
+     */
+    const std::string slow_code =
+      "WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c WHERE x < 1000000000) SELECT SUM(x) FROM c;";
+
+    /**
+     * \brief Step the slow statement.
+     * \return Reason it was interrupted, or std::nullopt if it completed.
+     */
+    std::optional<sql::InterruptReason> runSlow(sql::Database& db)
+    {
+        auto stmt = db.createStatement(slow_code, true);
+        try
+        {
+            if (const auto res = stmt.step(); !res)
+            {
+                static_cast<void>(stmt.reset());
+                stmt.throwError("Failed to step through slow statement.", res);
+            }
+        }
+        catch (const sql::InterruptError& e)
+        {
+            return e.getReason();
+        }
+        return std::nullopt;
+    }
+}  // namespace
+
+void Cancellation::operator()()
+{
+    // Create table.
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("MyTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t> table(*t);
+
+    expectNoThrow([&] {
+        auto insert = table.insert().compile();
+        for (int64_t i = 0; i < 100; i++) insert(i);
+    });
+
+    // Deadline.
+    {
+        sql::CancellationScope scope(*db, 20ms);
+        const auto             reason = runSlow(*db);
+        compareTrue(reason == sql::InterruptReason::Deadline);
+    }
+
+    // Token cancelled from another thread.
+    {
+        sql::CancellationToken token;
+        sql::CancellationScope scope(*db, token);
+
+        std::jthread thread([token] {
+            std::this_thread::sleep_for(20ms);
+            token.cancel();
+        });
+
+        const auto reason = runSlow(*db);
+        compareTrue(reason == sql::InterruptReason::Cancelled);
+        compareTrue(token.isCancelled());
+    }
+
+    // Interrupt from another thread.
+    {
+        std::jthread thread([this] {
+            std::this_thread::sleep_for(20ms);
+            db->interrupt();
+        });
+
+        const auto reason = runSlow(*db);
+        compareTrue(reason == sql::InterruptReason::Interrupt);
+    }
+
+    // Progress handler.
+    {
+        int64_t calls = 0;
+        expectNoThrow([&] { db->setProgressHandler(1000, [&] { return ++calls == 10; }); });
+        const auto reason = runSlow(*db);
+        compareTrue(reason == sql::InterruptReason::ProgressHandler);
+        compareEQ(calls, static_cast<int64_t>(10));
+        expectNoThrow([&] { db->clearProgressHandler(); });
+        expectThrow([&] { db->setProgressHandler(0, [] { return false; }); });
+    }
+
+    // Innermost expired scope stops the statement.
+    {
+        sql::CancellationScope outer(*db, 1h);
+        sql::CancellationScope inner(*db, 20ms);
+        const auto             reason = runSlow(*db);
+        compareTrue(reason == sql::InterruptReason::Deadline);
+    }
+
+    // Select statements are checked between rows.
+    {
+        sql::CancellationToken token;
+        sql::CancellationScope scope(*db, token);
+        auto                   select = table.select().compile();
+        int64_t                rows   = 0;
+        try
+        {
+            for (const auto& row : select)
+            {
+                static_cast<void>(row);
+                if (++rows == 10) token.cancel();
+            }
+        }
+        catch (const sql::InterruptError& e)
+        {
+            compareTrue(e.getReason() == sql::InterruptReason::Cancelled);
+        }
+        compareEQ(rows, static_cast<int64_t>(10));
+    }
+
+    // InterruptError is a SqliteError.
+    {
+        sql::CancellationToken token;
+        token.cancel();
+        sql::CancellationScope scope(*db, token);
+        auto                   select = table.select().compile();
+        expectThrow([&] {
+            try
+            {
+                static_cast<void>(select.begin());
+            }
+            catch (const sql::SqliteError& e)
+            {
+                compareEQ(e.getErrorCode(), SQLITE_INTERRUPT);
+                throw;
+            }
+        });
+    }
+
+    // Statements run normally once all scopes have ended.
+    compareEQ(table.count().compile()(), static_cast<int64_t>(100));
+}
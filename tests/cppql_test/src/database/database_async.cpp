@@ -0,0 +1,158 @@
+#include "cppql_test/database/database_async.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <format>
+#include <future>
+#include <thread>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void DatabaseAsync::operator()()
+{
+    const auto cwd    = std::filesystem::current_path();
+    const auto dbPath = cwd / "async.db";
+    std::filesystem::remove(dbPath);
+
+    constexpr int64_t threadCount = 8;
+    constexpr int64_t rowCount    = 100;
+
+    // Requires a database.
+    expectThrow([] { sql::AsyncDatabase async(nullptr); });
+
+    sql::DatabasePtr db;
+    expectNoThrow([&] { db = sql::Database::create(dbPath); });
+    db->setShutdown(sql::Database::Shutdown::Off);
+
+    sql::TypedTable<int64_t, int64_t> table;
+    expectNoThrow([&] {
+        auto& t = db->createTable("MyTable");
+        t.createColumn("col1", sql::Column::Type::Int);
+        t.createColumn("col2", sql::Column::Type::Int);
+        t.commit();
+        table = sql::TypedTable<int64_t, int64_t>(t);
+    });
+
+    {
+        sql::AsyncDatabase async(std::move(db));
+
+        // Statements are compiled on the writer thread.
+        auto insert = async.submit([&](sql::Database& d) { return table.insert().compile(d); }).get();
+        auto count  = async.submit([&](sql::Database& d) { return table.count().compile(d); }).get();
+
+        // Submit inserts from several threads.
+        std::vector<std::vector<std::future<void>>> futures(threadCount);
+        {
+            std::vector<std::thread> threads;
+            for (int64_t i = 0; i < threadCount; i++)
+            {
+                threads.emplace_back([&, i] {
+                    for (int64_t j = 0; j < rowCount; j++) futures[i].emplace_back(async.submit(insert, i, j));
+                });
+            }
+            for (auto& thread : threads) thread.join();
+        }
+        expectNoThrow([&] {
+            for (auto& fs : futures)
+                for (auto& f : fs) f.get();
+        });
+        compareEQ(async.submit(count).get(), threadCount * rowCount);
+
+        // Submissions of a single thread run in order.
+        compareEQ(async
+                    .submit([](sql::Database& d) {
+                        auto stmt = d.createStatement("SELECT COUNT(*) FROM MyTable a JOIN MyTable b ON a.col1 = b.col1 "
+                                                      "AND a.col2 < b.col2 AND a.rowid > b.rowid;",
+                                                      true);
+                        static_cast<void>(stmt.step());
+                        return stmt.column<int64_t>(0);
+                    })
+                    .get(),
+                  static_cast<int64_t>(0));
+
+        // Exceptions are stored in the future.
+        auto failed = async.submit([](sql::Database&) -> int64_t { throw sql::CppqlError("failed"); });
+        expectThrow([&] { static_cast<void>(failed.get()); });
+
+        // Remaining submissions run before the destructor returns. These do not use the statements above, which are
+        // destroyed before the AsyncDatabase.
+        for (int64_t j = 0; j < rowCount; j++)
+        {
+            static_cast<void>(async.submit([&, j](sql::Database& d) {
+                const auto stmt =
+                  d.createStatement(std::format("INSERT INTO MyTable VALUES ({}, {});", threadCount, j), true);
+                static_cast<void>(stmt.step());
+            }));
+        }
+    }
+
+    expectNoThrow([&] {
+        db = sql::Database::open(dbPath);
+        db->setShutdown(sql::Database::Shutdown::Off);
+        table = sql::TypedTable<int64_t, int64_t>(db->getTable("MyTable"));
+        compareEQ(table.count().compile()(), (threadCount + 1) * rowCount);
+    });
+
+    // Batch size must be positive.
+    expectThrow([&] {
+        auto memory = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        memory->setShutdown(sql::Database::Shutdown::Off);
+        sql::GroupCommitPolicy policy;
+        policy.maxBatchSize = 0;
+        sql::AsyncDatabase async(std::move(memory), policy);
+    });
+
+    // Group commit.
+    {
+        sql::GroupCommitPolicy policy;
+        policy.maxBatchSize = 16;
+        policy.maxLatency   = std::chrono::milliseconds(1);
+        sql::AsyncDatabase async(std::move(db), policy);
+
+        auto insert = async.submit([&](sql::Database& d) { return table.insert().compile(d); }).get();
+        auto count  = async.submit([&](sql::Database& d) { return table.count().compile(d); }).get();
+
+        // A failed submission only rolls back its own writes.
+        std::vector<std::future<void>> futures;
+        for (int64_t j = 0; j < rowCount; j++)
+        {
+            if (j % 10 == 0)
+            {
+                futures.emplace_back(async.submit([&, j](sql::Database&) {
+                    insert(threadCount + 1, j);
+                    throw sql::CppqlError("failed");
+                }));
+            }
+            else
+                futures.emplace_back(async.submit(insert, threadCount + 1, j));
+        }
+        for (int64_t j = 0; j < rowCount; j++)
+        {
+            if (j % 10 == 0)
+                expectThrow([&] { futures[j].get(); });
+            else
+                expectNoThrow([&] { futures[j].get(); });
+        }
+        compareEQ(async.submit(count).get(), (threadCount + 1) * rowCount + rowCount - rowCount / 10);
+
+        const auto stats = async.getStats();
+        compareEQ(stats.failedBatches, static_cast<int64_t>(0));
+        compareTrue(stats.batches > 0);
+        compareTrue(stats.batches < stats.submissions);
+    }
+
+    std::filesystem::remove(dbPath);
+}
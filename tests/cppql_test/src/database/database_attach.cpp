@@ -0,0 +1,118 @@
+#include "cppql_test/database/database_attach.h"
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void DatabaseAttach::operator()()
+{
+    const auto cwd      = std::filesystem::current_path();
+    const auto coldPath = cwd / "attach_cold.db";
+    std::filesystem::remove(coldPath);
+
+    expectNoThrow([&] {
+        const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+
+        // Alias must be an identifier and unique.
+        expectThrow([&] { db->attach(coldPath, "cold storage"); });
+        db->attach(coldPath, "cold");
+        compareTrue(db->isAttached("cold"));
+        expectThrow([&] { db->attach(coldPath, "cold"); });
+
+        // Create tables in main and attached database.
+        auto& hot = db->createTable("Orders");
+        hot.createColumn("id", sql::Column::Type::Int).primaryKey();
+        hot.createColumn("user", sql::Column::Type::Int);
+        hot.createColumn("total", sql::Column::Type::Real);
+        hot.commit();
+
+        auto& users = db->createTable("cold.Users");
+        users.createColumn("id", sql::Column::Type::Int).primaryKey();
+        users.createColumn("name", sql::Column::Type::Text);
+        users.commit();
+
+        auto& cold = db->createTable("cold.Orders");
+        cold.createColumn("id", sql::Column::Type::Int).primaryKey();
+        cold.createColumn("user", sql::Column::Type::Int).foreignKey(users.getColumn("id"));
+        cold.createColumn("total", sql::Column::Type::Real);
+        cold.commit();
+
+        compareEQ(hot.getQualifiedName(), std::string("Orders"));
+        compareEQ(cold.getQualifiedName(), std::string("cold.Orders"));
+        compareEQ(cold.getSchema(), std::string("cold"));
+        compareTrue(&db->getTable("cold.Orders") == &cold);
+
+        const sql::TypedTable<int64_t, int64_t, double> hotOrders(hot);
+        const sql::TypedTable<int64_t, std::string>     coldUsers(users);
+        const sql::TypedTable<int64_t, int64_t, double> coldOrders(cold);
+
+        auto insertUser = coldUsers.insert().compile();
+        insertUser(1, sql::toText("alice"));
+        insertUser(2, sql::toText("bob"));
+        auto insertHot = hotOrders.insert().compile();
+        insertHot(10, 1, 5.0);
+        insertHot(11, 2, 7.0);
+        auto insertCold = coldOrders.insert().compile();
+        insertCold(1, 1, 1.5);
+
+        // Queries emit schema-qualified names.
+        auto count = coldOrders.count();
+        count.generateIndices();
+        compareEQ(count.toString(), std::string("SELECT COUNT(*) FROM cold.Orders ;"));
+        compareEQ(count.compile()(), static_cast<int64_t>(1));
+
+        // Join across files.
+        auto select = hotOrders.join(sql::InnerJoin, coldUsers)
+                        .on(hotOrders.col<1>() == coldUsers.col<0>())
+                        .select(hotOrders.col<0>(), coldUsers.col<1>())
+                        .orderBy(ascending(hotOrders.col<0>()));
+        compareTrue(select.toString().find("FROM Orders INNER JOIN cold.Users ON Orders.user = cold.Users.id") !=
+                    std::string::npos)
+          .info(select.toString());
+        auto                                          stmt = select.compile();
+        std::vector<std::tuple<int64_t, std::string>> rows(stmt.begin(), stmt.end());
+        compareEQ(rows.size(), static_cast<size_t>(2));
+        compareEQ(rows[0], std::make_tuple<int64_t, std::string>(10, "alice"));
+        compareEQ(rows[1], std::make_tuple<int64_t, std::string>(11, "bob"));
+
+        auto del = coldOrders.del().where(coldOrders.col<0>() == 1).compile();
+        del.bind(sql::BindParameters::All);
+        del();
+        compareEQ(coldOrders.count().compile()(), static_cast<int64_t>(0));
+
+        db->detach("cold");
+        compareFalse(db->isAttached("cold"));
+        expectThrow([&] { static_cast<void>(db->getTable("cold.Orders")); });
+        expectThrow([&] { db->detach("cold"); });
+    });
+
+    // Tables of attached databases are read according to the schema loading mode.
+    for (const auto mode : {sql::SchemaLoading::Eager, sql::SchemaLoading::Lazy})
+    {
+        expectNoThrow([&] {
+            sql::DatabaseOptions options;
+            options.schemaLoading = mode;
+            const auto db         = sql::Database::create("", options, SQLITE_OPEN_MEMORY);
+            db->setShutdown(sql::Database::Shutdown::Off);
+            db->attach(coldPath, "cold");
+
+            const auto& orders = db->getTable("cold.Orders");
+            compareEQ(orders.getColumnCount(), static_cast<size_t>(3));
+            compareTrue(orders.getColumn("id").isPrimaryKey());
+            compareTrue(orders.getColumn("user").isForeignKey());
+            compareEQ(orders.getColumn("user").getForeignKey()->getTable().getQualifiedName(),
+                      std::string("cold.Users"));
+        });
+    }
+
+    std::filesystem::remove(coldPath);
+}
@@ -0,0 +1,104 @@
+#include "cppql_test/database/database_backup.h"
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void DatabaseBackup::operator()()
+{
+    const auto cwd        = std::filesystem::current_path();
+    const auto sourcePath = cwd / "backup_source.db";
+    const auto backupPath = cwd / "backup.db";
+    std::filesystem::remove(sourcePath);
+    std::filesystem::remove(backupPath);
+
+    sql::DatabasePtr source;
+    expectNoThrow([&] { source = sql::Database::create(sourcePath); });
+    source->setShutdown(sql::Database::Shutdown::Off);
+
+    // Create table and insert enough rows to need multiple steps.
+    sql::TypedTable<int64_t, std::string> table;
+    expectNoThrow([&] {
+        auto& t = source->createTable("MyTable");
+        t.createColumn("col1", sql::Column::Type::Int);
+        t.createColumn("col2", sql::Column::Type::Text);
+        t.commit();
+        table = sql::TypedTable<int64_t, std::string>(t);
+
+        auto       transaction = source->beginTransaction(sql::Transaction::Type::Deferred);
+        auto       insert      = table.insert().compile();
+        const auto text        = std::string(200, 'x');
+        for (int64_t i = 0; i < 1000; i++) insert(i, sql::toText(text));
+        transaction.commit();
+    });
+
+    // Backup to file in small steps.
+    int32_t steps = 0, lastRemaining = -1;
+    expectNoThrow([&] {
+        sql::BackupOptions options;
+        options.pagesPerStep = 10;
+        options.progress     = [&](const int32_t remaining, int32_t) {
+            steps++;
+            lastRemaining = remaining;
+        };
+        source->backupTo(backupPath, options);
+    });
+    compareTrue(steps > 1);
+    compareEQ(lastRemaining, 0);
+
+    expectNoThrow([&] {
+        const auto backup = sql::Database::open(backupPath);
+        backup->setShutdown(sql::Database::Shutdown::Off);
+        const sql::TypedTable<int64_t, std::string> backupTable(backup->getTable("MyTable"));
+        compareEQ(backupTable.count().compile()(), 1000);
+    });
+
+    // Backup to database. Schema of destination is reread.
+    expectNoThrow([&] {
+        const auto backup = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        backup->setShutdown(sql::Database::Shutdown::Off);
+        expectThrow([&] { static_cast<void>(backup->getTable("MyTable")); });
+        source->backupTo(*backup);
+        const sql::TypedTable<int64_t, std::string> backupTable(backup->getTable("MyTable"));
+        compareEQ(backupTable.count().compile()(), 1000);
+    });
+
+    // Backup gives up when the destination stays locked.
+    expectNoThrow([&] {
+        const auto backup = sql::Database::open(backupPath);
+        backup->setShutdown(sql::Database::Shutdown::Off);
+        auto transaction = backup->beginTransaction(sql::Transaction::Type::Exclusive);
+
+        sql::BackupOptions options;
+        options.busyTimeout = std::chrono::milliseconds(50);
+        expectThrow([&] {
+            try
+            {
+                source->backupTo(backupPath, options);
+            }
+            catch (const sql::SqliteError& e)
+            {
+                compareEQ(e.getErrorCode(), SQLITE_BUSY);
+                throw;
+            }
+        });
+
+        // Once the lock is released the backup succeeds.
+        transaction.commit();
+        source->backupTo(backupPath, options);
+    });
+
+    expectThrow([&] { source->backupTo(*source); });
+
+    source.reset();
+    std::filesystem::remove(sourcePath);
+    std::filesystem::remove(backupPath);
+}
@@ -0,0 +1,111 @@
+#include "cppql_test/database/database_busy.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <thread>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+using namespace std::chrono_literals;
+
+void DatabaseBusy::operator()()
+{
+    const auto cwd    = std::filesystem::current_path();
+    const auto dbPath = cwd / "busy.db";
+    std::filesystem::remove(dbPath);
+
+    // Create table.
+    expectNoThrow([&] {
+        const auto db    = sql::Database::create(dbPath);
+        auto&      table = db->createTable("MyTable");
+        table.createColumn("col1", sql::Column::Type::Int);
+        table.commit();
+    });
+
+    sql::DatabasePtr holder, waiter;
+    expectNoThrow([&] {
+        holder = sql::Database::open(dbPath);
+        waiter = sql::Database::open(dbPath);
+    });
+    holder->setShutdown(sql::Database::Shutdown::Off);
+    waiter->setShutdown(sql::Database::Shutdown::Off);
+    sql::TypedTable<int64_t> table(waiter->getTable("MyTable"));
+
+    // Without busy policy, a locked database fails immediately.
+    expectNoThrow([&] {
+        const auto transaction = holder->beginTransaction(sql::Transaction::Type::Immediate);
+        expectThrow([&] { auto insert = table.insert().compile(); insert(1); });
+        compareEQ(waiter->getBusyStats().busyCount, static_cast<size_t>(0));
+    });
+
+    // With busy policy, the insert waits until the lock is released.
+    sql::BusyPolicy policy;
+    policy.maxWait = 5s;
+    expectNoThrow([&] { waiter->setBusyPolicy(policy); });
+    expectNoThrow([&] {
+        auto transaction = std::make_unique<sql::Transaction>(*holder, sql::Transaction::Type::Immediate);
+        std::thread release([&] {
+            std::this_thread::sleep_for(50ms);
+            transaction->commit();
+        });
+        auto insert = table.insert().compile();
+        expectNoThrow([&] { insert(2); });
+        release.join();
+    });
+    compareEQ(waiter->getBusyStats().busyCount, static_cast<size_t>(1));
+    compareTrue(waiter->getBusyStats().retryCount > 0);
+    compareTrue(waiter->getBusyStats().waitTime > 0us);
+
+    // Give up after the maximum wait time.
+    policy.maxWait = 10ms;
+    expectNoThrow([&] { waiter->setBusyPolicy(policy); });
+    expectNoThrow([&] {
+        const auto transaction = holder->beginTransaction(sql::Transaction::Type::Immediate);
+        expectThrow([&] { auto insert = table.insert().compile(); insert(3); });
+    });
+    compareEQ(waiter->getBusyStats().timeoutCount, static_cast<size_t>(1));
+
+    // Retries of beginning a transaction share the maximum wait time with the busy handler.
+    policy.maxWait = 100ms;
+    expectNoThrow([&] { waiter->setBusyPolicy(policy); });
+    expectNoThrow([&] {
+        const auto transaction = holder->beginTransaction(sql::Transaction::Type::Immediate);
+        waiter->getBusyHandler()->resetStats();
+        const auto start = std::chrono::steady_clock::now();
+        expectThrow([&] { static_cast<void>(waiter->beginTransaction(sql::Transaction::Type::Immediate, 1000)); });
+        const auto elapsed = std::chrono::steady_clock::now() - start;
+        compareTrue(elapsed < 4 * policy.maxWait).info("Retries must stop after about twice the maximum wait time.");
+
+        // Each attempt is a single busy event.
+        const auto stats = waiter->getBusyStats();
+        compareTrue(stats.busyCount > 0);
+        compareEQ(stats.timeoutCount, stats.busyCount + 1);
+    });
+
+    // Retry beginning a transaction without busy handler.
+    expectNoThrow([&] { waiter->clearBusyPolicy(); });
+    compareTrue(waiter->getBusyHandler() == nullptr);
+    expectNoThrow([&] {
+        auto transaction = std::make_unique<sql::Transaction>(*holder, sql::Transaction::Type::Immediate);
+        std::thread release([&] {
+            std::this_thread::sleep_for(20ms);
+            transaction->commit();
+        });
+        expectNoThrow([&] {
+            auto t = waiter->beginTransaction(sql::Transaction::Type::Immediate, 1000);
+            t.commit();
+        });
+        release.join();
+    });
+
+    holder.reset();
+    waiter.reset();
+    std::filesystem::remove(dbPath);
+}
@@ -0,0 +1,118 @@
+#include "cppql_test/database/database_checkpointer.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <thread>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    /**
+     * \brief Wait until the checkpointer has run at least the given number of checkpoints, or a timeout expires.
+     */
+    sql::CheckpointStats waitForCheckpoints(const sql::Checkpointer& checkpointer, const int64_t count)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + 5s;
+        auto       stats    = checkpointer.getStats();
+        while (stats.checkpoints < count && std::chrono::steady_clock::now() < deadline)
+        {
+            std::this_thread::sleep_for(1ms);
+            stats = checkpointer.getStats();
+        }
+        return stats;
+    }
+}  // namespace
+
+void DatabaseCheckpointer::operator()()
+{
+    // Requires a file database in WAL mode.
+    expectNoThrow([&] {
+        const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+        expectThrow([&] { db->setCheckpointer({}); });
+    });
+
+    const auto cwd    = std::filesystem::current_path();
+    const auto dbPath = cwd / "checkpointer.db";
+    std::filesystem::remove(dbPath);
+
+    expectNoThrow([&] {
+        const auto db = sql::Database::create(dbPath);
+        db->setShutdown(sql::Database::Shutdown::Off);
+        expectThrow([&] { db->setCheckpointer({}); });
+    });
+    std::filesystem::remove(dbPath);
+
+    sql::DatabaseOptions options;
+    options.journalMode       = sql::JournalMode::Wal;
+    options.walAutocheckpoint = 500;
+    sql::DatabasePtr db;
+    expectNoThrow([&] { db = sql::Database::create(dbPath, options); });
+    db->setShutdown(sql::Database::Shutdown::Off);
+
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("MyTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->createColumn("col2", sql::Column::Type::Blob);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t, std::vector<uint32_t>> table(*t);
+
+    // Automatic checkpoints are disabled while the checkpointer is attached.
+    sql::CheckpointPolicy policy;
+    policy.walFrames = 10;
+    policy.interval  = 10s;
+    expectNoThrow([&] { db->setCheckpointer(policy); });
+    compareTrue(db->getCheckpointer() != nullptr);
+    compareEQ(*db->getOptions().walAutocheckpoint, static_cast<int64_t>(0));
+
+    // Commits that grow the WAL past the threshold trigger a checkpoint.
+    expectNoThrow([&] {
+        auto                  insert = table.insert().compile();
+        std::vector<uint32_t> blob(1024);
+        for (int64_t i = 0; i < 20; i++) insert(i, sql::toStaticBlob(blob));
+    });
+    auto stats = waitForCheckpoints(*db->getCheckpointer(), 1);
+    compareTrue(stats.checkpoints >= 1);
+    compareTrue(stats.framesCheckpointed >= 10);
+    compareEQ(stats.busyCount, static_cast<int64_t>(0));
+    compareEQ(stats.errorCount, static_cast<int64_t>(0));
+    compareTrue(stats.totalTime > 0ns);
+
+    // Manual request, with a truncating checkpoint.
+    policy.mode = sql::CheckpointMode::Truncate;
+    expectNoThrow([&] { db->setCheckpointer(policy); });
+    expectNoThrow([&] {
+        auto insert = table.insert().compile();
+        insert(100, sql::toStaticBlob(std::vector<uint32_t>(4)));
+    });
+    db->getCheckpointer()->request();
+    stats = waitForCheckpoints(*db->getCheckpointer(), 1);
+    compareTrue(stats.checkpoints >= 1);
+    compareEQ(stats.walFrames, static_cast<int64_t>(0));
+    compareEQ(std::filesystem::file_size(cwd / "checkpointer.db-wal"), static_cast<uintmax_t>(0));
+
+    // Automatic checkpoints are restored.
+    expectNoThrow([&] { db->clearCheckpointer(); });
+    compareTrue(db->getCheckpointer() == nullptr);
+    compareEQ(*db->getOptions().walAutocheckpoint, static_cast<int64_t>(500));
+
+    db.reset();
+    std::filesystem::remove(dbPath);
+}
@@ -0,0 +1,247 @@
+#include "cppql_test/database/database_memory.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <chrono>
+#include <format>
+#include <tuple>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void DatabaseMemory::operator()()
+{
+    // Memory can only be configured while sqlite is not initialized.
+    expectNoThrow([&] {
+        const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+        expectThrow([&] { sql::configureMemory({.memoryStatus = true}); });
+    });
+    compareEQ(sqlite3_shutdown(), SQLITE_OK).info("Failed to shut down sqlite.");
+
+    sql::MemoryConfig config;
+    config.pageCache    = sql::PageCacheArena{.pageSize = 4096, .pages = 64};
+    config.lookaside    = sql::Lookaside{.slotSize = 256, .slots = 50};
+    config.memoryStatus = true;
+    expectNoThrow([&] { sql::configureMemory(config); });
+
+    expectNoThrow([&] {
+        sql::DatabaseOptions options;
+        options.pageSize  = 4096;
+        options.lookaside = sql::Lookaside{.slotSize = 512, .slots = 200};
+        const auto db     = sql::Database::create("", options, SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+
+        auto& table = db->createTable("blobs");
+        table.createColumn("data", sql::Column::Type::Blob);
+        table.commit();
+        auto stmt = db->createStatement("INSERT INTO blobs VALUES (randomblob(1000));", true);
+        for (int32_t i = 0; i < 100; i++)
+        {
+            static_cast<void>(stmt.step());
+            static_cast<void>(stmt.reset());
+        }
+
+        // Pages are served from the arena.
+        const auto stats = sql::getMemoryStats();
+        compareTrue(stats.pageCacheUsed > 0).info("Page cache arena is not used.");
+        compareEQ(stats.pageCacheOverflow, static_cast<int64_t>(0)).info("Page cache arena overflowed.");
+        compareTrue(stats.memoryUsed > 0);
+        compareTrue(stats.memoryHighwater >= stats.memoryUsed);
+        compareTrue(stats.mallocCount > 0);
+    });
+
+    // Restore defaults for the remaining tests.
+    compareEQ(sqlite3_shutdown(), SQLITE_OK).info("Failed to shut down sqlite.");
+    expectNoThrow([&] {
+        sql::configureMemory({.pageCache = sql::PageCacheArena{.pages = 0}, .lookaside = sql::Lookaside{}});
+    });
+
+    expectNoThrow([&] {
+        const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+        compareEQ(sql::getMemoryStats().pageCacheUsed, static_cast<int64_t>(0));
+    });
+
+    // All allocations are served from the heap arena.
+    constexpr int64_t heapSize = 8 * 1024 * 1024;
+    compareEQ(sqlite3_shutdown(), SQLITE_OK).info("Failed to shut down sqlite.");
+    expectNoThrow([&] { sql::configureMemory({.heap = sql::HeapArena{.size = heapSize, .minAllocation = 32}}); });
+    expectNoThrow([&] {
+        const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+
+        auto& table = db->createTable("blobs");
+        table.createColumn("data", sql::Column::Type::Blob);
+        table.commit();
+        static_cast<void>(sql::getMemoryStats(true));
+        auto insert = db->createStatement("INSERT INTO blobs VALUES (randomblob(1000));", true);
+        for (int32_t i = 0; i < 1000; i++)
+        {
+            static_cast<void>(insert.step());
+            static_cast<void>(insert.reset());
+        }
+
+        auto select = db->createStatement("SELECT COUNT(*), SUM(length(data)) FROM blobs;", true);
+        static_cast<void>(select.step());
+        compareEQ(select.column<int64_t>(0), static_cast<int64_t>(1000));
+        compareEQ(select.column<int64_t>(1), static_cast<int64_t>(1000000));
+
+        const auto stats = sql::getMemoryStats();
+        compareTrue(stats.memoryUsed > 1000000);
+        compareTrue(stats.memoryHighwater <= heapSize).info("Allocations were not served from the heap arena.");
+
+        // Allocations fail once the arena is exhausted.
+        auto large = db->createStatement("SELECT randomblob(16000000);", true);
+        compareEQ(large.step().code, SQLITE_NOMEM);
+    });
+
+    // Compare select and insert throughput of the default allocator and the heap arena.
+    const auto measure = [&](const sql::MemoryConfig& cfg) {
+        using clock = std::chrono::steady_clock;
+        std::chrono::microseconds insertTime{}, selectTime{};
+        int64_t                   rows = 0;
+
+        compareEQ(sqlite3_shutdown(), SQLITE_OK).info("Failed to shut down sqlite.");
+        expectNoThrow([&] { sql::configureMemory(cfg); });
+        expectNoThrow([&] {
+            const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+            db->setShutdown(sql::Database::Shutdown::Off);
+
+            auto& table = db->createTable("rows");
+            table.createColumn("id", sql::Column::Type::Blob);
+            table.createColumn("name", sql::Column::Type::Text);
+            table.commit();
+
+            auto start = clock::now();
+            {
+                auto transaction = db->beginTransaction(sql::Transaction::Type::Deferred);
+                auto insert =
+                  db->createStatement("INSERT INTO rows VALUES (randomblob(8), 'row ' || hex(randomblob(16)));", true);
+                for (int32_t i = 0; i < 20000; i++)
+                {
+                    static_cast<void>(insert.step());
+                    static_cast<void>(insert.reset());
+                }
+                transaction.commit();
+            }
+            insertTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start);
+
+            start             = clock::now();
+            const auto select = db->createStatement("SELECT id, name FROM rows ORDER BY name;", true);
+            for (int32_t i = 0; i < 5; i++)
+            {
+                while (select.step().code == SQLITE_ROW)
+                    rows += static_cast<int64_t>(select.column<std::string>(1).size());
+                static_cast<void>(select.reset());
+            }
+            selectTime = std::chrono::duration_cast<std::chrono::microseconds>(clock::now() - start);
+        });
+        return std::make_tuple(insertTime, selectTime, rows);
+    };
+
+    const auto [arenaInsert, arenaSelect, arenaRows] =
+      measure({.heap = sql::HeapArena{.size = 64 * 1024 * 1024}});
+    const auto [defaultInsert, defaultSelect, defaultRows] = measure({.heap = sql::HeapArena{.size = 0}});
+    const auto timings = std::format("Insert: default {}us, arena {}us. Select: default {}us, arena {}us.",
+                                     defaultInsert.count(),
+                                     arenaInsert.count(),
+                                     defaultSelect.count(),
+                                     arenaSelect.count());
+    compareEQ(arenaRows, defaultRows).info(timings);
+    compareTrue(arenaInsert < 4 * defaultInsert).info(timings);
+    compareTrue(arenaSelect < 4 * defaultSelect).info(timings);
+
+    // Run time limits.
+    expectNoThrow([&] {
+        const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+
+        const auto length = db->getLimit(sql::Database::Limit::Length);
+        compareEQ(db->setLimit(sql::Database::Limit::Length, 100), length);
+        compareEQ(db->getLimit(sql::Database::Limit::Length), 100);
+        expectThrow([&] { static_cast<void>(db->setLimit(sql::Database::Limit::Length, -1)); });
+
+        auto stmt = db->createStatement("SELECT randomblob(1000);", true);
+        compareEQ(stmt.step().code, SQLITE_TOOBIG);
+    });
+
+    // Releasing memory and memory budgets.
+    const auto dbPath = std::filesystem::current_path() / "memory.db";
+    std::filesystem::remove(dbPath);
+    expectNoThrow([&] {
+        const auto db = sql::Database::create(dbPath);
+        db->setShutdown(sql::Database::Shutdown::Off);
+
+        auto& table = db->createTable("blobs");
+        table.createColumn("data", sql::Column::Type::Blob);
+        table.commit();
+        static_cast<void>(db->createStatement("WITH RECURSIVE c(x) AS (SELECT 1 UNION ALL SELECT x + 1 FROM c WHERE "
+                                              "x < 1000) INSERT INTO blobs SELECT randomblob(1000) FROM c;",
+                                              true)
+                            .step());
+
+        const auto before = db->getMemoryUsage().cacheUsed;
+        compareTrue(before > 500000);
+        const auto released = db->releaseMemory();
+        compareTrue(released > 0);
+        compareEQ(db->getMemoryUsage().cacheUsed, before - released);
+
+        // Callback fires once the cache exceeds the budget.
+        int64_t           calls = 0;
+        sql::MemoryBudget budget;
+        budget.cacheBytes    = 100000;
+        budget.checkInterval = 2;
+        budget.callback      = [&](sql::Database& d, const sql::ConnectionMemory& usage) {
+            compareTrue(usage.cacheUsed > 100000);
+            calls++;
+            static_cast<void>(d.releaseMemory());
+        };
+        expectNoThrow([&] { db->setMemoryBudget(budget); });
+        compareTrue(db->getMemoryBudget().has_value());
+
+        auto stmt = db->createStatement("SELECT SUM(length(data)) FROM blobs;", true);
+        for (int32_t i = 0; i < 4; i++)
+        {
+            static_cast<void>(stmt.step());
+            static_cast<void>(stmt.reset());
+        }
+        compareEQ(calls, static_cast<int64_t>(2));
+        compareTrue(db->getMemoryUsage().cacheUsed < 100000);
+
+        // Without callback, memory is released automatically.
+        budget.callback = nullptr;
+        db->setMemoryBudget(budget);
+        static_cast<void>(stmt.step());
+        static_cast<void>(stmt.reset());
+        compareTrue(db->checkMemoryBudget());
+        compareTrue(db->getMemoryUsage().cacheUsed < 100000);
+        compareFalse(db->checkMemoryBudget());
+
+        db->clearMemoryBudget();
+        compareFalse(db->getMemoryBudget().has_value());
+        expectThrow([&] { db->setMemoryBudget({.checkInterval = 0}); });
+    });
+    std::filesystem::remove(dbPath);
+
+    // Process wide heap limits.
+    expectNoThrow([&] {
+        const auto soft = sql::getSoftHeapLimit();
+        compareEQ(sql::setSoftHeapLimit(64 * 1024 * 1024), soft);
+        compareEQ(sql::getSoftHeapLimit(), static_cast<int64_t>(64 * 1024 * 1024));
+        compareEQ(sql::setSoftHeapLimit(soft), static_cast<int64_t>(64 * 1024 * 1024));
+        expectThrow([&] { static_cast<void>(sql::setHardHeapLimit(-1)); });
+        compareEQ(sql::setHardHeapLimit(sql::getHardHeapLimit()), sql::getHardHeapLimit());
+    });
+}
@@ -0,0 +1,84 @@
+#include "cppql_test/database/database_options.h"
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/core/database.h"
+
+void DatabaseOptions::operator()()
+{
+    const auto cwd    = std::filesystem::current_path();
+    const auto dbPath = cwd / "options.db";
+    std::filesystem::remove(dbPath);
+
+    sql::DatabaseOptions options;
+    options.pageSize          = 8192;
+    options.journalMode       = sql::JournalMode::Wal;
+    options.synchronous       = sql::Synchronous::Normal;
+    options.cacheSize         = -4096;
+    options.mmapSize          = 0;
+    options.tempStore         = sql::TempStore::Memory;
+    options.lockingMode       = sql::LockingMode::Normal;
+    options.foreignKeys       = true;
+    options.busyTimeout       = std::chrono::milliseconds(250);
+    options.walAutocheckpoint = 500;
+
+    // All options should be applied on creation and be readable back.
+    expectNoThrow([&] {
+        const auto db     = sql::Database::create(dbPath, options);
+        const auto actual = db->getOptions();
+        compareEQ(*actual.pageSize, *options.pageSize);
+        compareTrue(*actual.journalMode == sql::JournalMode::Wal);
+        compareTrue(*actual.synchronous == sql::Synchronous::Normal);
+        compareEQ(*actual.cacheSize, *options.cacheSize);
+        // Memory-mapped I/O can be disabled at compile time.
+        if (actual.mmapSize) compareEQ(*actual.mmapSize, *options.mmapSize);
+        compareTrue(*actual.tempStore == sql::TempStore::Memory);
+        compareTrue(*actual.lockingMode == sql::LockingMode::Normal);
+        compareTrue(*actual.foreignKeys);
+        compareEQ(actual.busyTimeout->count(), options.busyTimeout->count());
+        compareEQ(*actual.walAutocheckpoint, *options.walAutocheckpoint);
+
+        auto& table = db->createTable("MyTable");
+        table.createColumn("col1", sql::Column::Type::Int);
+        table.commit();
+    });
+
+    // Journal mode and page size are persistent, the other options are not.
+    expectNoThrow([&] {
+        sql::DatabaseOptions reopen;
+        reopen.pageSize   = 4096;
+        const auto db     = sql::Database::open(dbPath, reopen);
+        const auto actual = db->getOptions();
+        compareEQ(*actual.pageSize, *options.pageSize);
+        compareTrue(*actual.journalMode == sql::JournalMode::Wal);
+        compareFalse(*actual.foreignKeys);
+        compareEQ(actual.busyTimeout->count(), static_cast<int64_t>(0));
+    });
+
+    // Applying only some options leaves the others untouched.
+    expectNoThrow([&] {
+        sql::DatabaseOptions partial;
+        partial.foreignKeys = true;
+        const auto db       = sql::Database::create("", partial, SQLITE_OPEN_MEMORY);
+        const auto actual   = db->getOptions();
+        compareTrue(*actual.foreignKeys);
+        compareTrue(*actual.journalMode == sql::JournalMode::Memory);
+    });
+
+    // In-memory databases cannot use WAL mode.
+    expectThrow([] {
+        sql::DatabaseOptions wal;
+        wal.journalMode = sql::JournalMode::Wal;
+        auto db         = sql::Database::create("", wal, SQLITE_OPEN_MEMORY);
+    });
+
+    std::filesystem::remove(dbPath);
+}
@@ -0,0 +1,106 @@
+#include "cppql_test/database/database_pool.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <thread>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void DatabasePool::operator()()
+{
+    const auto cwd    = std::filesystem::current_path();
+    const auto dbPath = cwd / "pool.db";
+    std::filesystem::remove(dbPath);
+
+    // In-memory databases cannot be pooled.
+    expectThrow([] { sql::DatabasePool pool("", 1, SQLITE_OPEN_MEMORY); });
+
+    {
+        std::unique_ptr<sql::DatabasePool> pool;
+        expectNoThrow([&] { pool = std::make_unique<sql::DatabasePool>(dbPath, 4); });
+        compareEQ(pool->getReaderCount(), static_cast<size_t>(4));
+        compareEQ(pool->getAvailableReaderCount(), static_cast<size_t>(4));
+
+        // Create table and insert rows through writer.
+        sql::TypedTable<int64_t, std::string> table;
+        expectNoThrow([&] {
+            const auto writer = pool->writer();
+            compareTrue(writer.isWriter());
+            compareFalse(pool->tryWriter().has_value());
+
+            auto& t = writer->createTable("MyTable");
+            t.createColumn("col1", sql::Column::Type::Int);
+            t.createColumn("col2", sql::Column::Type::Text);
+            t.commit();
+            table = sql::TypedTable<int64_t, std::string>(t);
+
+            auto insert = table.insert().compile();
+            insert(10, sql::toText("abc"));
+            insert(20, sql::toText("def"));
+            insert(30, sql::toText("ghi"));
+        });
+        compareTrue(pool->tryWriter().has_value());
+
+        // Compile queries against leased readers from several threads.
+        std::vector<int64_t> counts(8, 0);
+        {
+            std::vector<std::thread> threads;
+            for (size_t i = 0; i < counts.size(); i++)
+            {
+                threads.emplace_back([&, i] {
+                    const auto reader = pool->reader();
+                    auto       count  = table.count().compile(*reader);
+                    counts[i]         = count();
+                });
+            }
+            for (auto& thread : threads) thread.join();
+        }
+        for (const auto c : counts) compareEQ(c, static_cast<int64_t>(3));
+        compareEQ(pool->getAvailableReaderCount(), static_cast<size_t>(4));
+
+        // Select through a reader.
+        expectNoThrow([&] {
+            const auto reader = pool->reader();
+            compareFalse(reader.isWriter());
+            compareEQ(pool->getAvailableReaderCount(), static_cast<size_t>(3));
+
+            auto                                          select = table.select().compile(*reader);
+            std::vector<std::tuple<int64_t, std::string>> rows(select.begin(), select.end());
+            compareEQ(rows.size(), static_cast<size_t>(3));
+            compareEQ(rows[1], std::make_tuple<int64_t, std::string>(20, "def"));
+        });
+
+        // Readers cannot write.
+        expectThrow([&] {
+            const auto reader = pool->reader();
+            auto       insert = table.insert().compile(*reader);
+            insert(40, sql::toText("jkl"));
+        });
+
+        // Exhaust readers.
+        {
+            std::vector<sql::DatabasePool::Lease> leases;
+            for (size_t i = 0; i < 4; i++) leases.emplace_back(pool->reader());
+            compareFalse(pool->tryReader().has_value());
+            leases.pop_back();
+            compareTrue(pool->tryReader().has_value());
+        }
+        compareEQ(pool->getAvailableReaderCount(), static_cast<size_t>(4));
+    }
+
+    std::filesystem::remove(dbPath);
+    std::filesystem::remove(cwd / "pool.db-wal");
+    std::filesystem::remove(cwd / "pool.db-shm");
+}
@@ -0,0 +1,80 @@
+#include "cppql_test/database/database_schema_loading.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void DatabaseSchemaLoading::operator()()
+{
+    const auto cwd    = std::filesystem::current_path();
+    const auto dbPath = cwd / "schema.db";
+    std::filesystem::remove(dbPath);
+
+    // Create tables with foreign keys in both directions.
+    expectNoThrow([&] {
+        const auto db = sql::Database::create(dbPath);
+        for (const auto* code : {"CREATE TABLE A (id INTEGER PRIMARY KEY AUTOINCREMENT, x TEXT NOT NULL, b INTEGER "
+                                 "REFERENCES B(id));",
+                                 "CREATE TABLE B (id INTEGER PRIMARY KEY, a INTEGER REFERENCES A(id), y BLOB);",
+                                 "CREATE TABLE C (k INTEGER, l REAL, PRIMARY KEY(k, l));"})
+        {
+            const auto stmt = db->createStatement(code, true);
+            compareTrue(static_cast<bool>(stmt.step()));
+        }
+    });
+
+    const auto check = [this](sql::Database& db) {
+        auto& a = db.getTable("A");
+        compareEQ(a.getColumnCount(), static_cast<size_t>(3));
+        compareTrue(a.getColumn("id").isPrimaryKey());
+        compareTrue(a.getColumn("id").isAutoIncrement());
+        compareTrue(a.getColumn("x").isNotNull());
+        compareTrue(a.getColumn("x").getType() == sql::Column::Type::Text);
+        compareTrue(a.getColumn("b").getForeignKey() == &db.getTable("B").getColumn("id"));
+
+        auto& b = db.getTable("B");
+        compareFalse(b.getColumn("id").isAutoIncrement());
+        compareTrue(b.getColumn("a").getForeignKey() == &a.getColumn("id"));
+        compareTrue(b.getColumn("y").getType() == sql::Column::Type::Blob);
+
+        auto& c = db.getTable("C");
+        compareTrue(c.getColumn("k").isPrimaryKey());
+        compareTrue(c.getColumn("l").isPrimaryKey());
+    };
+
+    // Read all tables on open.
+    expectNoThrow([&] {
+        const auto db = sql::Database::open(dbPath);
+        check(*db);
+    });
+
+    // Read tables on first access.
+    expectNoThrow([&] {
+        sql::DatabaseOptions options;
+        options.schemaLoading = sql::SchemaLoading::Lazy;
+        const auto db         = sql::Database::open(dbPath, options);
+        compareTrue(*db->getOptions().schemaLoading == sql::SchemaLoading::Lazy);
+
+        // Loading B also loads A, which it references.
+        expectNoThrow([&] { static_cast<void>(db->getTable("B")); });
+        check(*db);
+
+        expectThrow([&] { static_cast<void>(db->getTable("D")); });
+        expectThrow([&] { static_cast<void>(db->registerTable("C")); });
+    });
+
+    // Unloaded tables exist.
+    expectNoThrow([&] {
+        sql::DatabaseOptions options;
+        options.schemaLoading = sql::SchemaLoading::Lazy;
+        const auto db         = sql::Database::open(dbPath, options);
+        expectThrow([&] { static_cast<void>(db->createTable("C")); });
+        expectNoThrow([&] { static_cast<void>(db->registerTable("C")); });
+        expectNoThrow([&] { db->dropTable("C"); });
+        expectThrow([&] { static_cast<void>(db->getTable("C")); });
+    });
+
+    std::filesystem::remove(dbPath);
+}
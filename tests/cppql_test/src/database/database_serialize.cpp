@@ -0,0 +1,80 @@
+#include "cppql_test/database/database_serialize.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <algorithm>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void DatabaseSerialize::operator()()
+{
+    // Create seed database.
+    std::vector<std::byte> seed;
+    expectNoThrow([&] {
+        const auto db = sql::Database::create("", SQLITE_OPEN_MEMORY);
+        db->setShutdown(sql::Database::Shutdown::Off);
+        // Depending on the sqlite version, an empty database serializes to nothing or to a single page without any
+        // schema.
+        expectNoThrow([&] {
+            const auto empty = db->serialize();
+            if (empty.empty()) return;
+
+            const auto pageSize = db->createStatement("PRAGMA page_size;", true);
+            compareTrue(pageSize.step());
+            compareEQ(empty.size(), static_cast<size_t>(pageSize.column<int64_t>(0)));
+
+            const auto copy = sql::Database::deserialize(empty);
+            copy->setShutdown(sql::Database::Shutdown::Off);
+            const auto schema = copy->createStatement("SELECT COUNT(*) FROM sqlite_schema;", true);
+            compareTrue(schema.step());
+            compareEQ(schema.column<int64_t>(0), static_cast<int64_t>(0));
+        });
+
+        auto& t = db->createTable("MyTable");
+        t.createColumn("col1", sql::Column::Type::Int);
+        t.commit();
+        const sql::TypedTable<int64_t> table(t);
+        auto                           insert = table.insert().compile();
+        for (int64_t i = 0; i < 10; i++) insert(i);
+
+        seed = db->serialize();
+
+        // A regular in-memory database is usually not stored in contiguous memory. If it is, the data must match.
+        if (const auto data = db->serializeNoCopy(); !data.empty())
+            compareTrue(std::ranges::equal(data, seed));
+    });
+    compareFalse(seed.empty());
+
+    // Open multiple independent databases from the same seed.
+    for (int64_t i = 0; i < 3; i++)
+    {
+        expectNoThrow([&] {
+            const auto db = sql::Database::deserialize(seed);
+            db->setShutdown(sql::Database::Shutdown::Off);
+            compareEQ(db->serializeNoCopy().size(), seed.size());
+
+            const sql::TypedTable<int64_t> table(db->getTable("MyTable"));
+            auto                           insert = table.insert().compile();
+            insert(100);
+            compareEQ(table.count().compile()(), 11);
+        });
+    }
+
+    // Invalid data.
+    expectThrow([] {
+        const std::vector data(100, std::byte{7});
+        auto             db = sql::Database::deserialize(data);
+    });
+}
@@ -1,5 +1,17 @@
 #include "cppql_test/database/database_vacuum.h"
 
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <filesystem>
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
 ////////////////////////////////////////////////////////////////
 // Module includes.
 ////////////////////////////////////////////////////////////////
@@ -30,4 +42,54 @@ void DatabaseVacuum::operator()()
 
     // Run VACUUM command.
     expectNoThrow([&] { db->vacuum(); });
+
+    // Write compacted copy.
+    const auto copyPath = std::filesystem::current_path() / "vacuum_into.db";
+    if (exists(copyPath)) std::filesystem::remove(copyPath);
+    expectNoThrow([&] { db->vacuumInto(copyPath); });
+    compareTrue(exists(copyPath));
+    expectNoThrow([&] {
+        auto copy = sql::Database::open(copyPath);
+        copy->setShutdown(sql::Database::Shutdown::Off);
+        const sql::TypedTable<int64_t, float, std::string> copyTable(copy->getTable("myTable"));
+        compareEQ(copyTable.count().compile()(), 4);
+    });
+
+    // Destination must not exist yet.
+    expectThrow([&] { db->vacuumInto(copyPath); });
+    std::filesystem::remove(copyPath);
+
+    // Incremental vacuum.
+    sql::DatabaseOptions options;
+    options.autoVacuum = sql::AutoVacuum::Incremental;
+    sql::DatabasePtr incDb;
+    expectNoThrow([&] { incDb = sql::Database::create("", options, SQLITE_OPEN_MEMORY); });
+    incDb->setShutdown(sql::Database::Shutdown::Off);
+    compareTrue(incDb->getOptions().autoVacuum == sql::AutoVacuum::Incremental);
+
+    expectNoThrow([&] {
+        auto& blobs = incDb->createTable("blobs");
+        blobs.createColumn("data", sql::Column::Type::Blob);
+        blobs.commit();
+
+        auto transaction = incDb->beginTransaction(sql::Transaction::Type::Deferred);
+        const auto insert = incDb->createStatement("INSERT INTO blobs VALUES (randomblob(1000));", true);
+        for (int32_t i = 0; i < 100; i++)
+        {
+            static_cast<void>(insert.step());
+            static_cast<void>(insert.reset());
+        }
+        transaction.commit();
+
+        static_cast<void>(incDb->createStatement("DELETE FROM blobs;", true).step());
+    });
+
+    // Free pages are removed in steps.
+    int64_t freePages = 0;
+    expectNoThrow([&] { freePages = incDb->getFreePageCount(); });
+    compareTrue(freePages > 10);
+    compareEQ(incDb->incrementalVacuum(10), static_cast<int64_t>(10));
+    compareEQ(incDb->getFreePageCount(), freePages - 10);
+    compareEQ(incDb->incrementalVacuum(), freePages - 10);
+    compareEQ(incDb->getFreePageCount(), static_cast<int64_t>(0));
 }
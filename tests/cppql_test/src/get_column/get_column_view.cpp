@@ -0,0 +1,92 @@
+#include "cppql_test/get_column/get_column_view.h"
+
+#include "cppql/include_all.h"
+
+namespace
+{
+    struct Row
+    {
+        int64_t                  id;
+        std::string_view         text;
+        std::span<const int32_t> values;
+    };
+}  // namespace
+
+void GetColumnView::operator()()
+{
+    // Create table.
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("myTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->createColumn("col2", sql::Column::Type::Text);
+        t->createColumn("col3", sql::Column::Type::Blob);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t, std::string, std::vector<int32_t>> table(*t);
+
+    // Insert several rows.
+    expectNoThrow([&] {
+        auto                 insert = table.insert().compile();
+        std::vector<int32_t> values = {1, 2, 3};
+        insert(1, sql::toText("abc"), sql::toStaticBlob(values));
+        values = {4, 5};
+        insert(2, sql::toText("defg"), sql::toStaticBlob(values));
+        values.clear();
+        insert(3, sql::toText(""), sql::toStaticBlob(values));
+    });
+
+    // Retrieve views with a statement.
+    {
+        const auto stmt = db->createStatement("SELECT col2, col3 FROM myTable ORDER BY col1;", true);
+
+        std::string_view         text;
+        std::span<const int32_t> values;
+
+        compareTrue(stmt.step());
+        stmt.column(0, text);
+        stmt.column(1, values);
+        compareEQ(text, "abc");
+        compareEQ(std::vector(values.begin(), values.end()), std::vector<int32_t>{1, 2, 3});
+        compareEQ(stmt.column<std::span<const std::byte>>(1).size(), 3 * sizeof(int32_t));
+
+        compareTrue(stmt.step());
+        compareEQ(stmt.column<std::string_view>(0), "defg");
+        values = stmt.column<std::span<const int32_t>>(1);
+        compareEQ(std::vector(values.begin(), values.end()), std::vector<int32_t>{4, 5});
+
+        // Empty values result in empty views.
+        compareTrue(stmt.step());
+        stmt.column(0, text);
+        stmt.column(1, values);
+        compareTrue(text.empty());
+        compareTrue(values.empty());
+    }
+
+    // Size of blob must be a multiple of size of object.
+    {
+        const auto stmt = db->createStatement("SELECT x'010203';", true);
+        compareTrue(stmt.step());
+        std::span<const int32_t> values;
+        expectThrow([&] { stmt.column(0, values); });
+    }
+
+    // Retrieve views with a select statement.
+    {
+        auto sel = table.selectAs<Row>(table.col<0>(), table.col<1>(), table.col<2>())
+                     .orderBy(ascending(table.col<0>()))
+                     .compile();
+
+        std::vector<std::pair<std::string, std::vector<int32_t>>> rows;
+        for (const auto& row : sel)
+            rows.emplace_back(std::string(row.text), std::vector(row.values.begin(), row.values.end()));
+
+        compareEQ(rows.size(), static_cast<size_t>(3));
+        compareEQ(rows[0].first, "abc");
+        compareEQ(rows[0].second, std::vector<int32_t>{1, 2, 3});
+        compareEQ(rows[1].first, "defg");
+        compareEQ(rows[1].second, std::vector<int32_t>{4, 5});
+        compareTrue(rows[2].first.empty());
+        compareTrue(rows[2].second.empty());
+    }
+}
@@ -50,7 +50,17 @@
 #include "cppql_test/create_column/create_column_real.h"
 #include "cppql_test/create_column/create_column_text.h"
 #include "cppql_test/create_column/create_column_unique.h"
+#include "cppql_test/database/database_async.h"
+#include "cppql_test/database/database_attach.h"
+#include "cppql_test/database/database_backup.h"
+#include "cppql_test/database/database_busy.h"
+#include "cppql_test/database/database_checkpointer.h"
 #include "cppql_test/database/database_create.h"
+#include "cppql_test/database/database_memory.h"
+#include "cppql_test/database/database_options.h"
+#include "cppql_test/database/database_pool.h"
+#include "cppql_test/database/database_schema_loading.h"
+#include "cppql_test/database/database_serialize.h"
 #include "cppql_test/database/database_vacuum.h"
 #include "cppql_test/expressions/expression_aggregate.h"
 #include "cppql_test/expressions/expression_column.h"
@@ -65,6 +75,7 @@
 #include "cppql_test/get_column/get_column_template.h"
 #include "cppql_test/get_column/get_column_text.h"
 #include "cppql_test/get_column/get_column_type.h"
+#include "cppql_test/get_column/get_column_view.h"
 #include "cppql_test/queries/query_count.h"
 #include "cppql_test/queries/query_delete.h"
 #include "cppql_test/queries/query_insert.h"
@@ -86,7 +97,16 @@
 #include "cppql_test/typed_table/create_typed_table_int.h"
 #include "cppql_test/typed_table/create_typed_table_real.h"
 #include "cppql_test/typed_table/create_typed_table_text.h"
+#include "cppql_test/cancellation.h"
+#include "cppql_test/query_plan.h"
+#include "cppql_test/query_plan_regression.h"
+#include "cppql_test/savepoint.h"
+#include "cppql_test/slow_query_log.h"
+#include "cppql_test/snapshot.h"
+#include "cppql_test/sqlite_runtime.h"
+#include "cppql_test/statement_cache.h"
 #include "cppql_test/statement_prepare.h"
+#include "cppql_test/statement_stats.h"
 #include "cppql_test/statement_step.h"
 #include "cppql_test/transaction.h"
 
@@ -142,7 +162,17 @@ int main(const int argc, char** argv)
                    CreateColumnText,
                    CreateColumnUnique,
                    CreateTable,
+                   DatabaseAsync,
+                   DatabaseAttach,
+                   DatabaseBackup,
+                   DatabaseBusy,
+                   DatabaseCheckpointer,
                    DatabaseCreate,
+                   DatabaseMemory,
+                   DatabaseOptions,
+                   DatabasePool,
+                   DatabaseSchemaLoading,
+                   DatabaseSerialize,
                    DatabaseVacuum,
                    DropTable,
                    RegisterTable,
@@ -164,6 +194,7 @@ int main(const int argc, char** argv)
                    GetColumnTemplate,
                    GetColumnText,
                    GetColumnType,
+                   GetColumnView,
                    QueryCount,
                    QueryDelete,
                    QueryInsert,
@@ -171,12 +202,21 @@ int main(const int argc, char** argv)
                    QuerySelect,
                    QueryUnion,
                    QueryUpdate,
+                   Cancellation,
+                   QueryPlan,
+                   QueryPlanRegression,
+                   Savepoint,
+                   SlowQueryLog,
+                   Snapshot,
+                   SqliteRuntime,
+                   StatementCache,
                    StatementCount,
                    StatementDelete,
                    StatementInsert,
                    StatementPrepare,
                    StatementSelect,
                    StatementSelectOne,
+                   StatementStats,
                    StatementStep,
                    StatementUpdate,
                    Transaction>(argc, argv, "cppql");
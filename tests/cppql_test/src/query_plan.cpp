@@ -0,0 +1,166 @@
+#include "cppql_test/query_plan.h"
+
+#include "cppql/include_all.h"
+
+void QueryPlan::operator()()
+{
+    // Create table.
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("MyTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->createColumn("col2", sql::Column::Type::Int);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t, int64_t> table(*t);
+
+    expectNoThrow([&] {
+        auto insert = table.insert().compile();
+        for (int64_t i = 0; i < 10; i++) insert(i, i * 2);
+    });
+
+    // Without an index, filtering does a full scan.
+    expectNoThrow([&] {
+        const auto plan = table.select<0, 1>().where(table.col<0>() == 5).explain();
+        compareTrue(plan.usesFullScan("MyTable"));
+        compareFalse(plan.usesFullScan("My"));
+        compareEQ(plan.getNodes().size(), static_cast<size_t>(1));
+        compareEQ(plan.toString(), std::string("QUERY PLAN\n`--SCAN MyTable\n"));
+    });
+
+    expectNoThrow([&] {
+        const auto stmt = db->createStatement("CREATE INDEX MyIndex ON MyTable(col1);", true);
+        static_cast<void>(stmt.step());
+    });
+
+    // With an index, the same filter is a lookup.
+    expectNoThrow([&] {
+        const auto plan = table.select<0, 1>().where(table.col<0>() == 5).explain();
+        compareFalse(plan.usesFullScan("MyTable"));
+        compareTrue(plan.contains("SEARCH MyTable USING INDEX MyIndex"));
+    });
+
+    expectNoThrow([&] {
+        const auto plan = table.update<1>().where(table.col<0>() == 5).explain();
+        compareTrue(plan.contains("USING INDEX MyIndex"));
+    });
+
+    expectNoThrow([&] {
+        const auto plan = table.del().where(table.col<1>() > 4).explain();
+        compareTrue(plan.usesFullScan("MyTable"));
+    });
+
+    expectNoThrow([&] {
+        const auto plan = table.count().where(table.col<1>() > 4).explain();
+        compareTrue(plan.usesFullScan("MyTable"));
+    });
+
+    // Union results in a tree.
+    expectNoThrow([&] {
+        const auto plan = table.select<0, 1>()
+                            .where(table.col<0>() == 5)
+                            .unions(sql::UnionOperator::Union, table.select<0, 1>().where(table.col<1>() == 2))
+                            .explain();
+        compareEQ(plan.getNodes().size(), static_cast<size_t>(1));
+        compareTrue(plan.getNodes()[0].children.size() > 1);
+    });
+
+    // Per-loop counters.
+    auto select = table.select<0, 1>().where(table.col<1>() > 4).compile().bind(sql::BindParameters::All);
+    expectNoThrow([&] {
+        int64_t count = 0;
+        for (const auto& row : select)
+        {
+            static_cast<void>(row);
+            count++;
+        }
+        compareEQ(count, static_cast<int64_t>(7));
+    });
+
+#ifdef CPPQL_ENABLE_SCANSTATUS
+    expectNoThrow([&] {
+        const auto loops = select.getScanStatus();
+        compareEQ(loops.size(), static_cast<size_t>(1));
+        compareEQ(loops[0].name, std::string("MyTable"));
+        compareEQ(loops[0].loops, static_cast<int64_t>(1));
+        compareEQ(loops[0].rowsVisited, static_cast<int64_t>(10));
+
+        select.resetScanStatus();
+        compareEQ(select.getScanStatus()[0].loops, static_cast<int64_t>(0));
+    });
+#else
+    expectThrow([&] { static_cast<void>(select.getScanStatus()); });
+#endif
+
+    // Parse formatted plans.
+    expectNoThrow([&] {
+        const auto plan = sql::QueryPlan::parse("QUERY PLAN\n"
+                                                "`--COMPOUND QUERY\n"
+                                                "   |--LEFT-MOST SUBQUERY\n"
+                                                "   |  `--SEARCH Users USING INDEX UsersAge (age>?)\n"
+                                                "   `--UNION USING TEMP B-TREE\n"
+                                                "      `--SCAN Users\n");
+        compareEQ(plan.getNodes().size(), static_cast<size_t>(1));
+        compareEQ(plan.getNodes()[0].children.size(), static_cast<size_t>(2));
+        compareEQ(plan.getNodes()[0].children[0].children[0].detail,
+                  std::string("SEARCH Users USING INDEX UsersAge (age>?)"));
+        compareEQ(sql::QueryPlan::parse(plan.toString()).toString(), plan.toString());
+    });
+    expectThrow([&] { static_cast<void>(sql::QueryPlan::parse("QUERY PLAN\nSCAN Users\n")); });
+
+    // An index lookup that became a full scan is a regression.
+    expectNoThrow([&] {
+        const auto baseline = sql::QueryPlan::parse("QUERY PLAN\n`--SEARCH Users USING INDEX UsersAge (age>?)\n");
+        const auto plan     = sql::QueryPlan::parse("QUERY PLAN\n`--SCAN Users\n");
+        compareEQ(plan.findRegressions(baseline), std::vector<std::string>{"Full scan of Users: \"SCAN Users\"."});
+        compareTrue(baseline.findRegressions(plan).empty());
+    });
+
+    // An added temporary b-tree is a regression.
+    expectNoThrow([&] {
+        const auto baseline = sql::QueryPlan::parse("QUERY PLAN\n`--SEARCH Users USING INDEX UsersAge (age>?)\n");
+        const auto plan     = sql::QueryPlan::parse("QUERY PLAN\n"
+                                                    "|--SEARCH Users USING INDEX UsersAge (age>?)\n"
+                                                    "`--USE TEMP B-TREE FOR ORDER BY\n");
+        compareEQ(plan.findRegressions(baseline),
+                  std::vector<std::string>{"Added \"USE TEMP B-TREE FOR ORDER BY\"."});
+        compareTrue(baseline.findRegressions(plan).empty());
+    });
+
+    // An added automatic index is a regression.
+    expectNoThrow([&] {
+        const auto baseline = sql::QueryPlan::parse("QUERY PLAN\n"
+                                                    "|--SCAN Orders\n"
+                                                    "`--SEARCH Users USING INDEX sqlite_autoindex_Users_1 (id=?)\n");
+        const auto plan     = sql::QueryPlan::parse("QUERY PLAN\n"
+                                                    "|--SCAN Orders\n"
+                                                    "`--SEARCH Users USING AUTOMATIC COVERING INDEX (id=?)\n");
+        compareEQ(plan.findRegressions(baseline),
+                  std::vector<std::string>{"Added \"SEARCH Users USING AUTOMATIC COVERING INDEX (id=?)\"."});
+        compareTrue(baseline.findRegressions(plan).empty());
+    });
+
+    // An unchanged plan has no regressions.
+    expectNoThrow([&] {
+        const auto plan = sql::QueryPlan::parse("QUERY PLAN\n"
+                                                "|--SCAN Orders\n"
+                                                "|--SEARCH Users USING INDEX sqlite_autoindex_Users_1 (id=?)\n"
+                                                "`--USE TEMP B-TREE FOR ORDER BY\n");
+        compareTrue(plan.findRegressions(plan).empty());
+        compareTrue(plan.findRegressions(sql::QueryPlan::parse(plan.toString())).empty());
+    });
+
+    // Dropping the index makes the plan of a live statement regress.
+    expectNoThrow([&] {
+        const auto baseline = table.select<0, 1>().where(table.col<0>() == 5).explain();
+        compareTrue(table.select<0, 1>().where(table.col<0>() == 5).explain().findRegressions(baseline).empty());
+
+        const auto stmt = db->createStatement("DROP INDEX MyIndex;", true);
+        static_cast<void>(stmt.step());
+
+        const auto plan        = table.select<0, 1>().where(table.col<0>() == 5).explain();
+        const auto regressions = plan.findRegressions(baseline);
+        compareEQ(regressions.size(), static_cast<size_t>(1));
+        compareTrue(regressions[0].starts_with("Full scan of MyTable"));
+    });
+}
@@ -0,0 +1,97 @@
+#include "cppql_test/query_plan_regression.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <cstdlib>
+#include <filesystem>
+#include <format>
+#include <fstream>
+#include <sstream>
+
+#include "cppql/include_all.h"
+
+namespace
+{
+    [[nodiscard]] bool recordPlans()
+    {
+#ifdef WIN32
+        char*      value = nullptr;
+        size_t     size  = 0;
+        const auto found = _dupenv_s(&value, &size, "CPPQL_RECORD_PLANS") == 0 && value;
+        free(value);
+        return found;
+#else
+        return std::getenv("CPPQL_RECORD_PLANS") != nullptr;
+#endif
+    }
+}  // namespace
+
+void QueryPlanRegression::operator()()
+{
+    // Create tables.
+    sql::Table *u, *o;
+    expectNoThrow([&] {
+        u = &db->createTable("Users");
+        u->createColumn("id", sql::Column::Type::Int).primaryKey();
+        u->createColumn("name", sql::Column::Type::Text);
+        u->createColumn("age", sql::Column::Type::Int);
+        u->commit();
+
+        o = &db->createTable("Orders");
+        o->createColumn("id", sql::Column::Type::Int).primaryKey();
+        o->createColumn("user", sql::Column::Type::Int).foreignKey(u->getColumn("id"));
+        o->createColumn("total", sql::Column::Type::Real);
+        o->commit();
+
+        static_cast<void>(db->createStatement("CREATE INDEX UsersAge ON Users(age);", true).step());
+        static_cast<void>(db->createStatement("CREATE INDEX OrdersUser ON Orders(user);", true).step());
+    });
+    const sql::TypedTable<int64_t, std::string, int64_t> users(*u);
+    const sql::TypedTable<int64_t, int64_t, double>      orders(*o);
+
+    expectNoThrow([&] {
+        check("select_user_by_id", users.select<0, 1, 2>().where(users.col<0>() == 1).explain());
+
+        check("select_users_by_age",
+              users.select<0, 1>().where(users.col<2>() > 30).orderBy(ascending(users.col<2>())).explain());
+
+        check("select_user_orders",
+              users.join(sql::InnerJoin, orders)
+                .on(users.col<0>() == orders.col<1>())
+                .select(users.col<1>(), orders.col<2>())
+                .where(users.col<2>() > 30)
+                .explain());
+
+        check("count_orders_by_user", orders.count().where(orders.col<1>() == 1).explain());
+
+        check("update_user_age", users.update<2>().where(users.col<0>() == 1).explain());
+
+        check("delete_orders_by_user", orders.del().where(orders.col<1>() == 1).explain());
+    });
+}
+
+void QueryPlanRegression::check(const std::string& name, const sql::QueryPlan& plan)
+{
+    const auto path = std::filesystem::path(CPPQL_TEST_PLAN_DIR) / std::format("{}.txt", name);
+
+    if (recordPlans())
+    {
+        std::ofstream(path) << plan.toString();
+        return;
+    }
+
+    std::ifstream file(path);
+    compareTrue(file.is_open())
+      .info(std::format("Missing golden plan {}. Run with CPPQL_RECORD_PLANS set to record it.", path.string()));
+    if (!file.is_open()) return;
+
+    std::stringstream golden;
+    golden << file.rdbuf();
+
+    // Plans that changed without getting worse are accepted. Record them again to update the baseline.
+    std::string message;
+    for (const auto& r : plan.findRegressions(sql::QueryPlan::parse(golden.str()))) message += r + "\n";
+    compareTrue(message.empty()).info(std::format("Plan of {} regressed:\n{}{}", name, message, plan.toString()));
+}
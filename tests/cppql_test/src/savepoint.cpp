@@ -0,0 +1,67 @@
+#include "cppql_test/savepoint.h"
+
+#include "cppql/include_all.h"
+
+void Savepoint::operator()()
+{
+    // Create table.
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("MyTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t> table(*t);
+
+    auto count  = table.count().compile();
+    auto insert = table.insert().compile();
+
+    // Savepoint without transaction behaves like a transaction.
+    expectNoThrow([&] {
+        auto sp = db->beginSavepoint();
+        compareEQ(sp.getDepth(), static_cast<size_t>(0));
+        insert(10);
+        sp.release();
+    });
+    compareEQ(1, count());
+
+    // Nested savepoints inside of a transaction.
+    expectNoThrow([&] {
+        auto trans = db->beginTransaction(sql::Transaction::Type::Deferred);
+        insert(20);
+        {
+            auto sp0 = db->beginSavepoint();
+            insert(30);
+            {
+                auto sp1 = db->beginSavepoint();
+                compareEQ(sp1.getDepth(), static_cast<size_t>(1));
+                insert(40);
+                sp1.rollback();
+            }
+            compareEQ(3, count());
+            {
+                // Automatic rollback.
+                auto sp1 = db->beginSavepoint();
+                compareEQ(sp1.getDepth(), static_cast<size_t>(1));
+                insert(50);
+            }
+            compareEQ(3, count());
+            sp0.release();
+        }
+        trans.commit();
+    });
+    compareEQ(3, count());
+
+    // Rolling back the transaction undoes released savepoints.
+    expectNoThrow([&] {
+        auto trans = db->beginTransaction(sql::Transaction::Type::Deferred);
+        {
+            auto sp = db->beginSavepoint();
+            compareEQ(sp.getDepth(), static_cast<size_t>(0));
+            insert(60);
+            sp.release();
+        }
+        trans.rollback();
+    });
+    compareEQ(3, count());
+}
@@ -0,0 +1,49 @@
+#include "cppql_test/slow_query_log.h"
+
+#include "cppql/include_all.h"
+
+void SlowQueryLog::operator()()
+{
+    // Create table.
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("MyTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t> table(*t);
+
+    expectThrow([&] { db->setSlowQueryLog(std::chrono::nanoseconds(0), nullptr); });
+
+    // Record everything.
+    const auto sink = std::make_shared<sql::RingBufferSlowQuerySink>(2);
+    expectNoThrow([&] { db->setSlowQueryLog(std::chrono::nanoseconds(0), sink); });
+    compareTrue(db->getSlowQueryLog()->getSink() == sink);
+
+    expectNoThrow([&] {
+        auto insert = table.insert().compile();
+        for (int64_t i = 0; i < 5; i++) insert(i);
+
+        auto select = table.select<0>().where(table.col<0>() > 1).compile().bind(sql::BindParameters::All);
+        for (const auto& row : select) static_cast<void>(row);
+    });
+
+    // Only the last 2 records are kept.
+    auto records = sink->getRecords();
+    compareEQ(records.size(), static_cast<size_t>(2));
+    compareTrue(records[0].sql.starts_with("INSERT INTO MyTable"));
+    compareTrue(records[0].expandedSql.find('4') != std::string::npos);
+    compareEQ(records[0].rows, static_cast<int64_t>(0));
+    compareTrue(records[1].expandedSql.find("> 1") != std::string::npos);
+    compareEQ(records[1].rows, static_cast<int64_t>(3));
+
+    // Nothing is slow enough.
+    sink->clear();
+    expectNoThrow([&] { db->setSlowQueryLog(std::chrono::hours(1), sink); });
+    expectNoThrow([&] { compareEQ(table.count().compile()(), 5); });
+    compareTrue(sink->getRecords().empty());
+
+    // Disable.
+    expectNoThrow([&] { db->clearSlowQueryLog(); });
+    compareTrue(db->getSlowQueryLog() == nullptr);
+}
@@ -0,0 +1,108 @@
+#include "cppql_test/snapshot.h"
+
+////////////////////////////////////////////////////////////////
+// Standard includes.
+////////////////////////////////////////////////////////////////
+
+#include <thread>
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void Snapshot::operator()()
+{
+    const auto cwd    = std::filesystem::current_path();
+    const auto dbPath = cwd / "snapshot.db";
+    std::filesystem::remove(dbPath);
+
+    {
+        std::unique_ptr<sql::DatabasePool> pool;
+        expectNoThrow([&] { pool = std::make_unique<sql::DatabasePool>(dbPath, 4); });
+
+        sql::TypedTable<int64_t, std::string> table;
+        expectNoThrow([&] {
+            const auto writer = pool->writer();
+            auto&      t      = writer->createTable("MyTable");
+            t.createColumn("col1", sql::Column::Type::Int);
+            t.createColumn("col2", sql::Column::Type::Text);
+            t.commit();
+            table = sql::TypedTable<int64_t, std::string>(t);
+
+            auto insert = table.insert().compile();
+            insert(10, sql::toText("abc"));
+            insert(20, sql::toText("def"));
+            insert(30, sql::toText("ghi"));
+        });
+
+#ifdef CPPQL_ENABLE_SNAPSHOT
+        expectNoThrow([&] {
+            // Capture snapshot and keep the transaction open, so that the WAL cannot be reset in the meantime.
+            const auto reader      = pool->reader();
+            auto       transaction = reader->beginTransaction(sql::Transaction::Type::Deferred);
+            const auto snapshot    = transaction.getSnapshot();
+
+            // Write after the snapshot was captured.
+            {
+                const auto writer = pool->writer();
+                auto       insert = table.insert().compile(*writer);
+                insert(40, sql::toText("jkl"));
+            }
+
+            // Other readers see the data as of the snapshot, each counting part of the table on its own thread.
+            std::vector<int64_t> counts(3, 0);
+            {
+                std::vector<std::thread> threads;
+                for (size_t i = 0; i < counts.size(); i++)
+                {
+                    threads.emplace_back([&, i] {
+                        const auto other = pool->reader();
+                        auto       tr    = other->beginTransaction(snapshot);
+                        auto       count =
+                          table.count().where(table.col<0>() > static_cast<int64_t>(i * 10)).compile(*other);
+                        count.bind(sql::BindParameters::All);
+                        counts[i] = count();
+                        tr.commit();
+                    });
+                }
+                for (auto& thread : threads) thread.join();
+            }
+            compareEQ(counts[0], static_cast<int64_t>(3));
+            compareEQ(counts[1], static_cast<int64_t>(2));
+            compareEQ(counts[2], static_cast<int64_t>(1));
+
+            // Snapshot taken after the write is newer.
+            {
+                const auto other = pool->reader();
+                auto       tr    = other->beginTransaction(sql::Transaction::Type::Deferred);
+                compareTrue(snapshot.compare(tr.getSnapshot()) < 0);
+                compareEQ(table.count().compile(*other)(), static_cast<int64_t>(4));
+                tr.commit();
+            }
+
+            transaction.commit();
+        });
+
+        // Cannot capture a snapshot after writing.
+        expectThrow([&] {
+            const auto writer      = pool->writer();
+            auto       transaction = writer->beginTransaction(sql::Transaction::Type::Immediate);
+            auto       insert      = table.insert().compile(*writer);
+            insert(50, sql::toText("mno"));
+            static_cast<void>(transaction.getSnapshot());
+        });
+#else
+        expectThrow([&] {
+            const auto reader      = pool->reader();
+            auto       transaction = reader->beginTransaction(sql::Transaction::Type::Deferred);
+            static_cast<void>(transaction.getSnapshot());
+        });
+#endif
+    }
+
+    std::filesystem::remove(dbPath);
+    std::filesystem::remove(cwd / "snapshot.db-wal");
+    std::filesystem::remove(cwd / "snapshot.db-shm");
+}
@@ -0,0 +1,66 @@
+#include "cppql_test/sqlite_runtime.h"
+
+////////////////////////////////////////////////////////////////
+// External includes.
+////////////////////////////////////////////////////////////////
+
+#include "sqlite3.h"
+
+////////////////////////////////////////////////////////////////
+// Module includes.
+////////////////////////////////////////////////////////////////
+
+#include "cppql/include_all.h"
+
+void SqliteRuntime::operator()()
+{
+    // Start from a clean state, since previous tests may have left sqlite initialized.
+    compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(0));
+    compareEQ(sqlite3_shutdown(), SQLITE_OK);
+
+    expectNoThrow([&] {
+        // First reference configures sqlite.
+        sql::RuntimeConfig config;
+        config.uri    = true;
+        config.memory = sql::MemoryConfig{.memoryStatus = true};
+        sql::SqliteRuntime runtime(config);
+        compareTrue(runtime.holdsReference());
+        compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(1));
+
+        // Cannot configure while in use.
+        expectThrow([&] { sql::SqliteRuntime other(config); });
+        compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(1));
+
+        // Copies and databases hold their own references.
+        {
+            const auto copy = runtime;
+            compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(2));
+            const auto db = sql::Database::create("file:runtime?mode=memory", SQLITE_OPEN_URI);
+            compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(3));
+            compareTrue(db->getShutdown() == sql::Database::Shutdown::On);
+        }
+        compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(1));
+
+        // The database did not shut down sqlite, so it cannot be configured.
+        expectThrow([&] { sql::configureMemory({.memoryStatus = true}); });
+
+        // Moving transfers the reference.
+        auto moved = std::move(runtime);
+        compareFalse(runtime.holdsReference());
+        compareTrue(moved.holdsReference());
+        compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(1));
+    });
+
+    // The last reference shut down sqlite, so it can be configured again.
+    compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(0));
+    expectNoThrow([&] { sql::SqliteRuntime runtime(sql::RuntimeConfig{.uri = false}); });
+
+    // Releasing the last reference without shutting down keeps sqlite initialized.
+    expectNoThrow([&] {
+        sql::SqliteRuntime runtime;
+        runtime.setShutdown(false);
+    });
+    expectThrow([&] { sql::SqliteRuntime runtime(sql::RuntimeConfig{.uri = false}); });
+    compareEQ(sql::SqliteRuntime::getUseCount(), static_cast<int64_t>(0));
+    compareEQ(sqlite3_shutdown(), SQLITE_OK);
+}
@@ -0,0 +1,80 @@
+#include "cppql_test/statement_cache.h"
+
+#include "sqlite3.h"
+
+#include "cppql/include_all.h"
+
+void StatementCache::operator()()
+{
+    // Create table.
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("MyTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t> table(*t);
+
+    // Cache is disabled by default.
+    auto& cache = db->getStatementCache();
+    compareEQ(cache.getCapacity(), static_cast<size_t>(0));
+    {
+        auto stmt = sql::Statement(*db, "SELECT 1;", true);
+        compareTrue(stmt.isPrepared());
+    }
+    compareEQ(cache.getSize(), static_cast<size_t>(0));
+
+    // Enable cache and insert some rows. Statement is prepared once and reused afterwards.
+    cache.setCapacity(2);
+    sqlite3_stmt* handle = nullptr;
+    {
+        auto stmt = sql::Statement(*db, "INSERT INTO MyTable VALUES (?1);", true);
+        compareTrue(stmt.isPrepared());
+        compareTrue(stmt.bindInt(sql::Statement::getFirstBindIndex(), 10));
+        compareTrue(stmt.step());
+        handle = stmt.get();
+    }
+    compareEQ(cache.getSize(), static_cast<size_t>(1));
+    compareEQ(cache.getMisses(), static_cast<size_t>(1));
+    {
+        // Bindings are cleared when returned to the cache, so this inserts a null.
+        auto stmt = sql::Statement(*db, "INSERT INTO MyTable VALUES (?1);", true);
+        compareTrue(stmt.isPrepared());
+        compareEQ(stmt.get(), handle);
+        compareTrue(stmt.step());
+    }
+    compareEQ(cache.getHits(), static_cast<size_t>(1));
+    {
+        auto stmt = sql::Statement(*db, "SELECT COUNT(col1), COUNT(*) FROM MyTable;", true);
+        compareEQ(stmt.step().code, SQLITE_ROW);
+        compareEQ(stmt.column<int64_t>(0), static_cast<int64_t>(1));
+        compareEQ(stmt.column<int64_t>(1), static_cast<int64_t>(2));
+    }
+    compareEQ(cache.getSize(), static_cast<size_t>(2));
+
+    // Typed statements go through the cache as well.
+    expectNoThrow([&] {
+        auto insert = table.insert().compile();
+        insert(20);
+    });
+    expectNoThrow([&] {
+        auto insert = table.insert().compile();
+        insert(30);
+    });
+    compareEQ(cache.getHits(), static_cast<size_t>(2));
+    compareEQ(cache.getSize(), static_cast<size_t>(2));
+    compareEQ(table.count().compile()(), static_cast<sql::row_id>(4));
+
+    // Two live statements with the same code are not shared.
+    {
+        auto stmt0 = sql::Statement(*db, "SELECT 1;", true);
+        auto stmt1 = sql::Statement(*db, "SELECT 1;", true);
+        compareNE(stmt0.get(), stmt1.get());
+    }
+
+    // Shrinking finalizes least recently used statements.
+    cache.setCapacity(1);
+    compareEQ(cache.getSize(), static_cast<size_t>(1));
+    cache.clear();
+    compareEQ(cache.getSize(), static_cast<size_t>(0));
+}
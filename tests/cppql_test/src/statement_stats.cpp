@@ -0,0 +1,61 @@
+#include "cppql_test/statement_stats.h"
+
+#include "cppql/include_all.h"
+
+void StatementStats::operator()()
+{
+    // Create table.
+    sql::Table* t;
+    expectNoThrow([&] {
+        t = &db->createTable("MyTable");
+        t->createColumn("col1", sql::Column::Type::Int);
+        t->createColumn("col2", sql::Column::Type::Int);
+        t->commit();
+    });
+    const sql::TypedTable<int64_t, int64_t> table(*t);
+
+    // Unprepared statement has no stats.
+    {
+        const auto stmt = sql::Statement(*db, "SELECT * FROM MyTable;", false);
+        compareEQ(stmt.getStats().vmSteps, static_cast<int64_t>(0));
+    }
+
+    expectNoThrow([&] {
+        auto insert = table.insert().compile();
+        for (int64_t i = 0; i < 10; i++) insert(i, i * 2);
+        compareEQ(insert.getStats().runs, static_cast<int64_t>(10));
+        compareTrue(insert.getStats().vmSteps > 0);
+        compareTrue(insert.getStats().memoryUsed > 0);
+    });
+
+    // Filtering on a column without index does a full scan.
+    expectNoThrow([&] {
+        auto select = table.select<0, 1>().where(table.col<1>() > 4).compile().bind(sql::BindParameters::All);
+        int64_t count  = 0;
+        for (const auto& row : select)
+        {
+            static_cast<void>(row);
+            count++;
+        }
+        compareEQ(count, static_cast<int64_t>(7));
+        compareEQ(select.getStats().fullscanSteps, static_cast<int64_t>(9));
+        compareEQ(select.getStats().sorts, static_cast<int64_t>(0));
+
+        // Reset counters.
+        static_cast<void>(select.getStats(true));
+        compareEQ(select.getStats().fullscanSteps, static_cast<int64_t>(0));
+    });
+
+    expectNoThrow([&] {
+        auto count = table.count().compile();
+        compareEQ(count(), 10);
+        compareEQ(count.getStats().runs, static_cast<int64_t>(1));
+    });
+
+    // Connection stats.
+    expectNoThrow([&] {
+        const auto stats = db->getStats();
+        compareTrue(stats.schemaUsed > 0);
+        compareTrue(stats.cacheUsed > 0);
+    });
+}
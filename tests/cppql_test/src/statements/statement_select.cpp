@@ -12,6 +12,14 @@ namespace
 
     [[nodiscard]] bool operator==(const Foo& lhs, const Foo& rhs) noexcept { return lhs.a == rhs.a && lhs.b == rhs.b; }
 
+    struct Bar
+    {
+        int64_t              id;
+        std::vector<int32_t> a;
+        Foo                  b;
+        std::vector<Foo>     c;
+    };
+
 }  // namespace
 
 void StatementSelect::operator()()
@@ -141,4 +149,110 @@ void StatementSelect::operator()()
         const std::vector<int64_t> res(sel.begin(), sel.end());
         compareEQ(std::vector<int64_t>{30, 40, 40}, res);
     }
+
+    // Select into an existing row.
+    {
+        auto sel = table0.select<0, 2>().orderBy(ascending(table0.col<0>())).compile();
+
+        // Reserve more than any row needs, so that reuse of the string can be checked.
+        std::tuple<int64_t, std::string> row;
+        std::get<1>(row).reserve(64);
+        const auto* const data     = std::get<1>(row).data();
+        const auto        capacity = std::get<1>(row).capacity();
+
+        std::vector<int64_t> ids;
+        std::string          text;
+        while (sel.fetchInto(row))
+        {
+            ids.push_back(std::get<0>(row));
+            text += std::get<1>(row);
+            compareEQ(static_cast<const void*>(std::get<1>(row).data()), static_cast<const void*>(data));
+            compareEQ(std::get<1>(row).capacity(), capacity);
+        }
+        compareEQ(std::vector<int64_t>{10, 20, 30, 40, 40}, ids);
+        compareEQ(text, "abcdefghijaaaabbbb");
+
+        // Statement was reset after the last row.
+        compareTrue(sel.fetchInto(row));
+        compareEQ(std::get<0>(row), static_cast<int64_t>(10));
+        expectNoThrow([&sel] { sel.reset(); });
+
+        // Blobs of different sizes are assigned to the same vector.
+        auto sel2 = table1.selectAs<std::vector<int32_t>, 1>().orderBy(ascending(table1.col<0>())).compile();
+        std::vector<int32_t> values;
+        size_t               count = 0;
+        sel2.forEachInto(values, [&](const std::vector<int32_t>& v) {
+            compareEQ(v.size(), static_cast<size_t>(4));
+            count++;
+        });
+        compareEQ(count, static_cast<size_t>(2));
+        compareEQ(values, std::vector{-10, -11, -12, -13});
+    }
+
+    // Select into an existing aggregate row.
+    {
+        auto sel = table1.selectAs<Bar>().orderBy(ascending(table1.col<0>())).compile();
+
+        Bar row;
+        compareTrue(sel.fetchInto(row));
+        compareEQ(row.id, static_cast<int64_t>(1));
+        compareEQ(row.a, std::vector{0, 1, 2, 3});
+        compareEQ(row.b, Foo{.a = 10, .b = 5});
+        compareEQ(row.c, std::vector{Foo{.a = 20, .b = 30}, Foo{.a = 40, .b = 50}});
+
+        // Vectors are overwritten in place.
+        const auto* const aData     = row.a.data();
+        const auto        aCapacity = row.a.capacity();
+        const auto* const cData     = row.c.data();
+        const auto        cCapacity = row.c.capacity();
+
+        compareTrue(sel.fetchInto(row));
+        compareEQ(row.id, static_cast<int64_t>(2));
+        compareEQ(row.a, std::vector{-10, -11, -12, -13});
+        compareEQ(row.b, Foo{.a = -1000, .b = 0.5f});
+        compareEQ(row.c, std::vector{Foo{.a = 1000000, .b = 4.2f}, Foo{.a = -100, .b = -1.0f}});
+        compareEQ(static_cast<const void*>(row.a.data()), static_cast<const void*>(aData));
+        compareEQ(row.a.capacity(), aCapacity);
+        compareEQ(static_cast<const void*>(row.c.data()), static_cast<const void*>(cData));
+        compareEQ(row.c.capacity(), cCapacity);
+
+        compareFalse(sel.fetchInto(row));
+    }
+
+    // Select in batches.
+    {
+        auto sel = table0.selectAs<int64_t, 0>().orderBy(ascending(table0.col<0>())).compile();
+
+        std::vector<int64_t> batch;
+        compareTrue(sel.fetch(batch, 2));
+        compareEQ(batch, std::vector<int64_t>{10, 20});
+        compareTrue(sel.fetch(batch, 2));
+        compareEQ(batch, std::vector<int64_t>{30, 40});
+        compareFalse(sel.fetch(batch, 2));
+        compareEQ(batch, std::vector<int64_t>{40});
+
+        // Statement was reset after the last row.
+        compareEQ(sel.fetchAll(), std::vector<int64_t>{10, 20, 30, 40, 40});
+        compareEQ(sel.fetchAll(), std::vector<int64_t>{10, 20, 30, 40, 40});
+
+        // A batch that ends exactly at the last row reports that no rows remain.
+        compareFalse(sel.fetch(batch, 5));
+        compareEQ(batch, std::vector<int64_t>{10, 20, 30, 40, 40});
+        compareTrue(sel.fetch(batch, 1));
+        compareEQ(batch, std::vector<int64_t>{10});
+        compareTrue(sel.fetch(batch, 3));
+        compareEQ(batch, std::vector<int64_t>{20, 30, 40});
+        compareFalse(sel.fetch(batch, 1));
+        compareEQ(batch, std::vector<int64_t>{40});
+
+        // The row that was looked ahead to is not lost.
+        compareTrue(sel.fetch(batch, 2));
+        compareEQ(sel.fetchAll(), std::vector<int64_t>{30, 40, 40});
+        compareTrue(sel.fetch(batch, 4));
+        const std::vector<int64_t> rest(sel.begin(), sel.end());
+        compareEQ(rest, std::vector<int64_t>{40});
+
+        // Batches must not be empty.
+        expectThrow([&] { static_cast<void>(sel.fetch(batch, 0)); });
+    }
 }